@@ -155,6 +155,11 @@ namespace PCGExDataBlending
 		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->MultiBlend(SourceIndex, TargetIndex, InWeight, Trackers[i]); }
 	}
 
+	void FBlendOpsManager::MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> InWeights, TArray<PCGEx::FOpStats>& Trackers) const
+	{
+		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->MultiBlendRange(SourceIndices, TargetIndex, InWeights, Trackers[i]); }
+	}
+
 	void FBlendOpsManager::EndMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->EndMultiBlend(TargetIndex, Trackers[i]); }
@@ -5,6 +5,25 @@
 
 namespace PCGExDataBlending
 {
+	void FWeightedRuns::Build(const TArray<PCGExData::FWeightedPoint>& InWeightedPoints)
+	{
+		const int32 NumPoints = InWeightedPoints.Num();
+
+		Indices.SetNumUninitialized(NumPoints);
+		Weights.SetNumUninitialized(NumPoints);
+		Runs.Reset();
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			const PCGExData::FWeightedPoint& P = InWeightedPoints[i];
+			Indices[i] = P.Index;
+			Weights[i] = P.Weight;
+
+			if (Runs.IsEmpty() || Runs.Last().IO != P.IO) { Runs.Add(FRun{P.IO, i, 1}); }
+			else { Runs.Last().Count++; }
+		}
+	}
+
 	void FDummyUnionBlender::Init(const TSharedPtr<PCGExData::FFacade>& TargetData, const TArray<TSharedRef<PCGExData::FFacade>>& InSources)
 	{
 		CurrentTargetData = TargetData;
@@ -267,17 +267,20 @@ namespace PCGExDataBlending
 	{
 		if (InWeightedPoints.IsEmpty()) { return; }
 
+		FWeightedRuns WeightedRuns;
+		WeightedRuns.Build(InWeightedPoints);
+
 		// For each attribute/property we want to blend
 		for (const TSharedPtr<FMultiSourceBlender>& MultiAttribute : Blenders)
 		{
 			PCGEx::FOpStats Tracking = MultiAttribute->MainBlender->BeginMultiBlend(WriteIndex);
 
-			// For each point in the union, check if there is an attribute blender for that source; and if so, add it to the blend
-			for (const PCGExData::FWeightedPoint& P : InWeightedPoints)
+			// For each run of points in the union, check if there is an attribute blender for that source; and if so, add it to the blend
+			for (const FWeightedRuns::FRun& Run : WeightedRuns.Runs)
 			{
-				if (const TSharedPtr<FProxyDataBlender>& Blender = MultiAttribute->SubBlenders[P.IO])
+				if (const TSharedPtr<FProxyDataBlender>& Blender = MultiAttribute->SubBlenders[Run.IO])
 				{
-					Blender->MultiBlend(P.Index, WriteIndex, P.Weight, Tracking);
+					Blender->MultiBlendRange(WeightedRuns.GetIndices(Run), WriteIndex, WeightedRuns.GetWeights(Run), Tracking);
 				}
 			}
 
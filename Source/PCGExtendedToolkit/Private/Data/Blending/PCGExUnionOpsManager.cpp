@@ -77,8 +77,11 @@ namespace PCGExDataBlending
 
 		if (InWeightedPoints.IsEmpty()) { return; }
 
+		FWeightedRuns WeightedRuns;
+		WeightedRuns.Build(InWeightedPoints);
+
 		Blenders[0]->BeginMultiBlend(WriteIndex, Trackers);
-		for (const PCGExData::FWeightedPoint& P : InWeightedPoints) { Blenders[P.IO]->MultiBlend(P.Index, WriteIndex, P.Weight, Trackers); }
+		for (const FWeightedRuns::FRun& Run : WeightedRuns.Runs) { Blenders[Run.IO]->MultiBlendRange(WeightedRuns.GetIndices(Run), WriteIndex, WeightedRuns.GetWeights(Run), Trackers); }
 		Blenders[0]->EndMultiBlend(WriteIndex, Trackers);
 	}
 
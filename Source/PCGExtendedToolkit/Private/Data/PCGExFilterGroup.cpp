@@ -111,6 +111,8 @@ namespace PCGExFilterGroup
 			PostInitManagedFilter(InContext, Filter);
 		}
 
+		ScopeOrder.Init(ManagedFilters);
+
 		return true;
 	}
 
@@ -60,6 +60,15 @@ namespace PCGExPointFilter
 
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const { return bCollectionTestResult; }
 
+	void IFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+	{
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			int8& Mask = InOutMask[Index - Scope.Start];
+			if (Mask) { Mask = Test(Index); }
+		}
+	}
+
 	bool ISimpleFilter::Test(const int32 Index) const
 	PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::Test(const PCGExCluster::FNode& Node), false)
 
@@ -84,9 +93,77 @@ namespace PCGExPointFilter
 	bool ICollectionFilter::Test(const PCGExCluster::FNode& Node) const { return bCollectionTestResult; }
 	bool ICollectionFilter::Test(const PCGExGraph::FEdge& Edge) const { return bCollectionTestResult; }
 
+	void ICollectionFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(InOutMask.GetData(), InOutMask.Num() * sizeof(int8)); }
+	}
+
 	bool ICollectionFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 	PCGEX_NOT_IMPLEMENTED_RET(FCollectionFilter::Test(FPCGExContext* InContext, const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection), false)
 
+	void FFilterOrder::Init(const TArray<TSharedPtr<IFilter>>& InFilters)
+	{
+		Order = InFilters;
+		Profiles.Reset();
+		Profiles.SetNum(Order.Num());
+		NumSampledScopes = 0;
+
+		// Nothing to reorder
+		bFrozen.store(Order.Num() < 2, std::memory_order_release);
+	}
+
+	void FFilterOrder::Freeze()
+	{
+		FWriteScopeLock WriteScopeLock(OrderLock);
+
+		if (bFrozen.load(std::memory_order_acquire)) { return; }
+
+		// Expected cost of a short-circuited chain is minimized by sorting on cost / drop rate.
+		// Filters that never dropped anything (or never got to run) go last, in their original order.
+		TArray<double> Ranks;
+		Ranks.SetNumUninitialized(Order.Num());
+
+		for (int i = 0; i < Order.Num(); i++)
+		{
+			const FProfile& Profile = Profiles[i];
+			if (!Profile.Tested || !Profile.Dropped)
+			{
+				Ranks[i] = MAX_dbl;
+				continue;
+			}
+
+			const double Cost = static_cast<double>(Profile.Cycles) / static_cast<double>(Profile.Tested);
+			const double DropRate = static_cast<double>(Profile.Dropped) / static_cast<double>(Profile.Tested);
+			Ranks[i] = Cost / DropRate;
+		}
+
+		TArray<int32> Indices;
+		PCGEx::ArrayOfIndices(Indices, Order.Num());
+		Indices.StableSort([&](const int32 A, const int32 B) { return Ranks[A] < Ranks[B]; });
+
+		TArray<TSharedPtr<IFilter>> NewOrder;
+		NewOrder.Reserve(Order.Num());
+
+		TArray<FString> OrderDesc;
+		OrderDesc.Reserve(Order.Num());
+
+		for (const int32 i : Indices)
+		{
+			const FProfile& Profile = Profiles[i];
+			NewOrder.Add(Order[i]);
+			OrderDesc.Add(
+				FString::Printf(
+					TEXT("%s (%.1f cycles/pt, %.1f%% dropped)"), *Order[i]->Factory->GetName(),
+					Profile.Tested ? static_cast<double>(Profile.Cycles) / static_cast<double>(Profile.Tested) : 0.0,
+					Profile.Tested ? 100.0 * static_cast<double>(Profile.Dropped) / static_cast<double>(Profile.Tested) : 0.0));
+		}
+
+		UE_LOG(LogPCGEx, Verbose, TEXT("Adaptive filter order : %s"), *FString::Join(OrderDesc, TEXT(" > ")));
+
+		Order = MoveTemp(NewOrder);
+		bFrozen.store(true, std::memory_order_release);
+	}
+
 	FManager::FManager(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 		: PointDataFacade(InPointDataFacade)
 	{
@@ -151,44 +228,38 @@ namespace PCGExPointFilter
 
 	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults)
 	{
-		bool bResult = true;
-		int32 NumPass = 0;
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			bResult = true;
-			for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
-			{
-				if (!Handler->Test(Index))
-				{
-					bResult = false;
-					break;
-				}
-			}
-			OutResults[Index] = bResult;
-			NumPass += bResult;
-		}
+		const TArrayView<int8> Mask = Scope.GetView(OutResults);
+		FMemory::Memset(Mask.GetData(), 1, Scope.Count * sizeof(int8));
+		return TestScope(Scope, Mask);
+	}
+
+	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults)
+	{
+		TArray<int8> Mask;
+		Mask.Init(1, Scope.Count);
+
+		const int32 NumPass = TestScope(Scope, Mask);
+		for (int i = 0; i < Scope.Count; i++) { OutResults[Scope.Start + i] = static_cast<bool>(Mask[i]); }
 
 		return NumPass;
 	}
 
-	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults)
+	int32 FManager::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask)
 	{
-		bool bResult = true;
+		check(InOutMask.Num() == Scope.Count)
+
 		int32 NumPass = 0;
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			bResult = true;
-			for (const TSharedPtr<IFilter>& Handler : ManagedFilters)
+		for (const int8 Mask : InOutMask) { NumPass += Mask != 0; }
+
+		// Each filter only has to care about what's left of the selection
+		ScopeOrder.ForEach(
+			NumPass, [&](const TSharedPtr<IFilter>& Handler, int32& OutNumPass)
 			{
-				if (!Handler->Test(Index))
-				{
-					bResult = false;
-					break;
-				}
-			}
-			OutResults[Index] = bResult;
-			NumPass += bResult;
-		}
+				Handler->TestScope(Scope, InOutMask);
+
+				OutNumPass = 0;
+				for (const int8 Mask : InOutMask) { OutNumPass += Mask != 0; }
+			});
 
 		return NumPass;
 	}
@@ -302,6 +373,8 @@ namespace PCGExPointFilter
 			PostInitFilter(InContext, Filter);
 		}
 
+		ScopeOrder.Init(ManagedFilters);
+
 		if (bCacheResults) { InitCache(); }
 
 		return true;
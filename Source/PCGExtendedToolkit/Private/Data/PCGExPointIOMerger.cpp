@@ -124,28 +124,28 @@ void FPCGExPointIOMerger::MergeAsync(const TSharedPtr<PCGExMT::FTaskManager>& As
 		}
 	}
 
+	BuildSourceBlocks(GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+
+	// Write scopes are disjoint, so native properties can be copied block by block in parallel
+	if (!SourceBlocks.IsEmpty())
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, CopyPropertiesTask)
+
+		CopyPropertiesTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->CopyProperties(This->SourceBlocks[Index]);
+			};
+
+		CopyPropertiesTask->StartIterations(SourceBlocks.Num(), 1);
+	}
+
 	for (int i = 0; i < NumSources; i++)
 	{
-		const PCGExPointIOMerger::FMergeScope& Scope = Scopes[i];
 		const TSharedPtr<PCGExData::FPointIO> Source = IOSources[i];
 		UnionDataFacade->Source->Tags->Append(Source->Tags.ToSharedRef());
 
-		if (Scope.bReverse)
-		{
-			TArray<int32> TempWriteIndices;
-			PCGEx::ArrayOfIndices(TempWriteIndices, Scope.Write.Count, Scope.Write.Start);
-
-			Source->GetIn()->CopyPropertiesTo(
-				OutPointData, Scope.ReadIndices, TempWriteIndices,
-				Source->GetAllocations() & ~EPCGPointNativeProperties::MetadataEntry);
-		}
-		else
-		{
-			Source->GetIn()->CopyPropertiesTo(
-				OutPointData, Scope.Read.Start, Scope.Write.Start, Scope.Write.Count,
-				Source->GetAllocations() & ~EPCGPointNativeProperties::MetadataEntry);
-		}
-
 		// Discover attributes
 		UPCGMetadata* Metadata = Source->GetIn()->Metadata;
 		PCGEx::FAttributeIdentity::ForEach(
@@ -189,6 +189,52 @@ void FPCGExPointIOMerger::MergeAsync(const TSharedPtr<PCGExMT::FTaskManager>& As
 	}
 }
 
+void FPCGExPointIOMerger::CopyProperties(const PCGExMT::FScope& Block)
+{
+	UPCGBasePointData* OutPointData = UnionDataFacade->GetOut();
+
+	for (int i = Block.Start; i < Block.End; i++)
+	{
+		const PCGExPointIOMerger::FMergeScope& Scope = Scopes[i];
+		const TSharedPtr<PCGExData::FPointIO>& Source = IOSources[i];
+
+		if (Scope.bReverse)
+		{
+			TArray<int32> TempWriteIndices;
+			PCGEx::ArrayOfIndices(TempWriteIndices, Scope.Write.Count, Scope.Write.Start);
+
+			Source->GetIn()->CopyPropertiesTo(
+				OutPointData, Scope.ReadIndices, TempWriteIndices,
+				Source->GetAllocations() & ~EPCGPointNativeProperties::MetadataEntry);
+		}
+		else
+		{
+			Source->GetIn()->CopyPropertiesTo(
+				OutPointData, Scope.Read.Start, Scope.Write.Start, Scope.Write.Count,
+				Source->GetAllocations() & ~EPCGPointNativeProperties::MetadataEntry);
+		}
+	}
+}
+
+void FPCGExPointIOMerger::BuildSourceBlocks(const int32 BlockSize)
+{
+	SourceBlocks.Reset();
+
+	const int32 NumSources = IOSources.Num();
+	int32 BlockStart = 0;
+	int32 BlockPoints = 0;
+
+	for (int i = 0; i < NumSources; i++)
+	{
+		BlockPoints += Scopes[i].Write.Count;
+		if (BlockPoints < BlockSize && i < NumSources - 1) { continue; }
+
+		SourceBlocks.Emplace(BlockStart, i + 1 - BlockStart, SourceBlocks.Num());
+		BlockStart = i + 1;
+		BlockPoints = 0;
+	}
+}
+
 namespace PCGExPointIOMerger
 {
 	FCopyAttributeTask::FCopyAttributeTask(const int32 InTaskIndex, const TSharedPtr<FPCGExPointIOMerger>& InMerger)
@@ -211,15 +257,9 @@ namespace PCGExPointIOMerger
 					Identity.bInitDefault ? static_cast<const FPCGMetadataAttribute<T>*>(Identity.Attribute)->GetValue(PCGDefaultValueKey) : T{},
 					Identity.bAllowsInterpolation, PCGExData::EBufferInit::New);
 
-				for (int i = 0; i < Merger->IOSources.Num(); i++)
+				for (const PCGExMT::FScope& Block : Merger->SourceBlocks)
 				{
-					TSharedPtr<PCGExData::FPointIO> SourceIO = Merger->IOSources[i];
-					const FPCGMetadataAttributeBase* Attribute = SourceIO->GetIn()->Metadata->GetConstAttribute(Identity.Identifier);
-
-					if (!Attribute) { continue; }                            // Missing attribute
-					if (!Identity.IsA(Attribute->GetTypeId())) { continue; } // Type mismatch
-
-					PCGEX_LAUNCH_INTERNAL(FWriteAttributeScopeTask<T>, SourceIO, Merger->Scopes[i], Identity, Buffer)
+					PCGEX_LAUNCH_INTERNAL(FWriteAttributeBlockTask<T>, Merger, Block, TaskIndex, Buffer)
 				}
 			});
 	}
@@ -0,0 +1,249 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoBVH.h"
+
+#include <algorithm>
+
+namespace PCGExGeo
+{
+	FSegmentBVH::FSegmentBVH(const int32 InNumSegments, const TFunctionRef<void(int32, FVector&, FVector&)>& GetSegment, const int32 InMaxLeafSize)
+	{
+		const int32 NumSubtrees = BeginBuild(InNumSegments, GetSegment, InMaxLeafSize, 1);
+		for (int i = 0; i < NumSubtrees; i++) { BuildSubtree(i); }
+		EndBuild();
+	}
+
+	bool FSegmentBVH::SplitNode(TArray<FNode>& InNodes, const int32 NodeIndex)
+	{
+		const int32 Start = InNodes[NodeIndex].Start;
+		const int32 Count = InNodes[NodeIndex].Count;
+
+		FBox Bounds = FBox(ForceInit);
+		FBox CenterBounds = FBox(ForceInit);
+
+		for (int32 i = Start; i < Start + Count; i++)
+		{
+			const int32 Idx = Indices[i];
+			Bounds += RawStarts[Idx];
+			Bounds += RawEnds[Idx];
+			CenterBounds += Centers[Idx];
+		}
+
+		InNodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= MaxLeafSize) { return false; }
+
+		const FVector Extent = CenterBounds.GetExtent();
+		const int32 Axis = Extent.X >= Extent.Y ? (Extent.X >= Extent.Z ? 0 : 2) : (Extent.Y >= Extent.Z ? 1 : 2);
+
+		// Median split only needs a partition around the middle element, not a full sort of the range
+		const int32 Half = Count / 2;
+		int32* First = Indices.GetData() + Start;
+		std::nth_element(First, First + Half, First + Count, [&](const int32 A, const int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+
+		const int32 FirstChild = InNodes.Num();
+
+		FNode& Left = InNodes.Emplace_GetRef();
+		Left.Start = Start;
+		Left.Count = Half;
+
+		FNode& Right = InNodes.Emplace_GetRef();
+		Right.Start = Start + Half;
+		Right.Count = Count - Half;
+
+		InNodes[NodeIndex].Start = FirstChild;
+		InNodes[NodeIndex].Count = 0;
+
+		return true;
+	}
+
+	int32 FSegmentBVH::BeginBuild(const int32 InNumSegments, const TFunctionRef<void(int32, FVector&, FVector&)>& GetSegment, const int32 InMaxLeafSize, const int32 InMaxSubtrees)
+	{
+		Nodes.Reset();
+		Subtrees.Reset();
+		Indices.Reset();
+		Starts.Reset();
+		Ends.Reset();
+
+		if (InNumSegments <= 0) { return 0; }
+
+		MaxLeafSize = FMath::Max(1, InMaxLeafSize);
+
+		RawStarts.SetNumUninitialized(InNumSegments);
+		RawEnds.SetNumUninitialized(InNumSegments);
+		Centers.SetNumUninitialized(InNumSegments);
+		Indices.SetNumUninitialized(InNumSegments);
+
+		for (int i = 0; i < InNumSegments; i++)
+		{
+			GetSegment(i, RawStarts[i], RawEnds[i]);
+			Centers[i] = (RawStarts[i] + RawEnds[i]) * 0.5;
+			Indices[i] = i;
+		}
+
+		Nodes.Reserve(FMath::Max(1, 2 * InNumSegments / MaxLeafSize + 1));
+
+		FNode& Root = Nodes.Emplace_GetRef();
+		Root.Start = 0;
+		Root.Count = InNumSegments;
+
+		// Split level by level until there are enough independent subtrees to go around
+		TArray<int32> Pending;
+		TArray<int32> NextPending;
+		Pending.Add(0);
+
+		while (Pending.Num() * 2 <= InMaxSubtrees)
+		{
+			NextPending.Reset();
+
+			for (const int32 NodeIndex : Pending)
+			{
+				if (Nodes[NodeIndex].Count <= MaxLeafSize)
+				{
+					NextPending.Add(NodeIndex);
+					continue;
+				}
+
+				SplitNode(Nodes, NodeIndex);
+				NextPending.Add(Nodes[NodeIndex].Start);
+				NextPending.Add(Nodes[NodeIndex].Start + 1);
+			}
+
+			if (NextPending.Num() == Pending.Num()) { break; }
+			Swap(Pending, NextPending);
+		}
+
+		Subtrees.SetNum(Pending.Num());
+		for (int i = 0; i < Pending.Num(); i++) { Subtrees[i].Root = Pending[i]; }
+
+		return Subtrees.Num();
+	}
+
+	void FSegmentBVH::BuildSubtree(const int32 SubtreeIndex)
+	{
+		FSubtree& Subtree = Subtrees[SubtreeIndex];
+
+		// Subtrees own disjoint index ranges and node arrays, so they can be built concurrently
+		Subtree.Nodes.Reset();
+		Subtree.Nodes.Add(Nodes[Subtree.Root]);
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			if (!SplitNode(Subtree.Nodes, NodeIndex)) { continue; }
+
+			Stack.Add(Subtree.Nodes[NodeIndex].Start);
+			Stack.Add(Subtree.Nodes[NodeIndex].Start + 1);
+		}
+	}
+
+	void FSegmentBVH::EndBuild()
+	{
+		// Stitch subtrees into the flat node array; the subtree root replaces its placeholder, other nodes are appended
+		for (FSubtree& Subtree : Subtrees)
+		{
+			const int32 Base = Nodes.Num() - 1;
+			auto Remap = [&](FNode Node)
+			{
+				if (!Node.IsLeaf()) { Node.Start += Base; }
+				return Node;
+			};
+
+			Nodes[Subtree.Root] = Remap(Subtree.Nodes[0]);
+			for (int i = 1; i < Subtree.Nodes.Num(); i++) { Nodes.Add(Remap(Subtree.Nodes[i])); }
+		}
+
+		Subtrees.Empty();
+
+		// Store segments in leaf order
+		const int32 NumSegments = Indices.Num();
+		Starts.SetNumUninitialized(NumSegments);
+		Ends.SetNumUninitialized(NumSegments);
+		for (int i = 0; i < NumSegments; i++)
+		{
+			Starts[i] = RawStarts[Indices[i]];
+			Ends[i] = RawEnds[Indices[i]];
+		}
+
+		RawStarts.Empty();
+		RawEnds.Empty();
+		Centers.Empty();
+	}
+
+	int32 FSegmentBVH::FindClosest(const FVector& Position, double& OutDistSquared, double& OutAlpha, const double MaxDistSquared) const
+	{
+		int32 BestIndex = -1;
+		double BestDistSquared = MaxDistSquared;
+		double BestAlpha = 0;
+
+		OutDistSquared = MaxDistSquared;
+		OutAlpha = 0;
+
+		if (Nodes.IsEmpty()) { return -1; }
+
+		struct FEntry
+		{
+			int32 Node;
+			double DistSquared;
+		};
+
+		TArray<FEntry, TInlineAllocator<64>> Stack;
+		Stack.Add(FEntry{0, Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Position)});
+
+		while (!Stack.IsEmpty())
+		{
+			const FEntry Entry = Stack.Pop(EAllowShrinking::No);
+			if (Entry.DistSquared > BestDistSquared) { continue; }
+
+			const FNode& Node = Nodes[Entry.Node];
+
+			if (Node.IsLeaf())
+			{
+				for (int32 i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const FVector& A = Starts[i];
+					const FVector AB = Ends[i] - A;
+					const double LengthSquared = AB.SizeSquared();
+					const double Alpha = LengthSquared > 0 ? FMath::Clamp(FVector::DotProduct(Position - A, AB) / LengthSquared, 0.0, 1.0) : 0;
+					const double DistSquared = FVector::DistSquared(Position, A + AB * Alpha);
+
+					if (DistSquared < BestDistSquared || (DistSquared == BestDistSquared && BestIndex != -1 && Indices[i] < BestIndex))
+					{
+						BestIndex = Indices[i];
+						BestDistSquared = DistSquared;
+						BestAlpha = Alpha;
+					}
+				}
+
+				continue;
+			}
+
+			const double DistLeft = Nodes[Node.Start].Bounds.ComputeSquaredDistanceToPoint(Position);
+			const double DistRight = Nodes[Node.Start + 1].Bounds.ComputeSquaredDistanceToPoint(Position);
+
+			// Push the far child first so the near one is visited next
+			if (DistLeft <= DistRight)
+			{
+				if (DistRight <= BestDistSquared) { Stack.Add(FEntry{Node.Start + 1, DistRight}); }
+				if (DistLeft <= BestDistSquared) { Stack.Add(FEntry{Node.Start, DistLeft}); }
+			}
+			else
+			{
+				if (DistLeft <= BestDistSquared) { Stack.Add(FEntry{Node.Start, DistLeft}); }
+				if (DistRight <= BestDistSquared) { Stack.Add(FEntry{Node.Start + 1, DistRight}); }
+			}
+		}
+
+		if (BestIndex != -1)
+		{
+			OutDistSquared = BestDistSquared;
+			OutAlpha = BestAlpha;
+		}
+
+		return BestIndex;
+	}
+}
@@ -0,0 +1,203 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoGrid.h"
+
+#include "GeomTools.h"
+
+namespace PCGExGeo
+{
+	namespace GridInternal
+	{
+		constexpr uint8 CenterInside = 1 << 0;
+		constexpr uint8 Boundary = 1 << 1;
+
+		FORCEINLINE double Cross(const FVector2D& A, const FVector2D& B) { return A.X * B.Y - A.Y * B.X; }
+
+		FORCEINLINE bool SegmentsCross(const FVector2D& P1, const FVector2D& P2, const FVector2D& A, const FVector2D& B)
+		{
+			const FVector2D AB = B - A;
+			if ((Cross(AB, P1 - A) > 0) == (Cross(AB, P2 - A) > 0)) { return false; }
+			const FVector2D P12 = P2 - P1;
+			return (Cross(P12, A - P1) > 0) != (Cross(P12, B - P1) > 0);
+		}
+	}
+
+	FSegmentGrid2D::FSegmentGrid2D(const TArray<FVector2D>& InPoints, const bool bInClosedLoop, const double InPadding, const int32 InMaxResolution)
+		: Points(&InPoints), bClosedLoop(bInClosedLoop), Padding(FMath::Max(0.0, InPadding))
+	{
+		if (InPoints.Num() < 2) { return; }
+		Build(FBox2D(InPoints).ExpandBy(Padding), InMaxResolution);
+	}
+
+	void FSegmentGrid2D::Build(const FBox2D& InBounds, const int32 InMaxResolution)
+	{
+		const FVector2D Size = InBounds.GetSize();
+		const double MaxSize = FMath::Max(Size.X, Size.Y);
+		if (MaxSize <= UE_SMALL_NUMBER) { return; }
+
+		const int32 NumSegments = GetNumSegments();
+		const int32 Resolution = FMath::Clamp(FMath::CeilToInt32(FMath::Sqrt(static_cast<double>(NumSegments)) * 2), 1, FMath::Max(1, InMaxResolution));
+
+		CellSize = MaxSize / Resolution;
+		InvCellSize = 1 / CellSize;
+		Origin = InBounds.Min;
+
+		NumX = FMath::Clamp(FMath::CeilToInt32(Size.X * InvCellSize), 1, Resolution);
+		NumY = FMath::Clamp(FMath::CeilToInt32(Size.Y * InvCellSize), 1, Resolution);
+
+		const int32 NumCells = NumX * NumY;
+
+		// Visit every cell whose box comes within padding of the segment.
+		// Cells are restricted to the segment' padded AABB, so a line-vs-box test is enough.
+		auto ForEachSegmentCell = [&](const int32 SegmentIndex, auto&& Func)
+		{
+			FVector2D A, B;
+			GetSegment(SegmentIndex, A, B);
+
+			const int32 MinX = FMath::Clamp(FMath::FloorToInt32((FMath::Min(A.X, B.X) - Padding - Origin.X) * InvCellSize), 0, NumX - 1);
+			const int32 MaxX = FMath::Clamp(FMath::FloorToInt32((FMath::Max(A.X, B.X) + Padding - Origin.X) * InvCellSize), 0, NumX - 1);
+			const int32 MinY = FMath::Clamp(FMath::FloorToInt32((FMath::Min(A.Y, B.Y) - Padding - Origin.Y) * InvCellSize), 0, NumY - 1);
+			const int32 MaxY = FMath::Clamp(FMath::FloorToInt32((FMath::Max(A.Y, B.Y) + Padding - Origin.Y) * InvCellSize), 0, NumY - 1);
+
+			const FVector2D AB = B - A;
+			const double Len = AB.Length();
+			const bool bTrivial = MinX == MaxX || MinY == MaxY || Len <= UE_SMALL_NUMBER;
+			const FVector2D N = bTrivial ? FVector2D::ZeroVector : FVector2D(-AB.Y, AB.X) / Len;
+
+			for (int32 Y = MinY; Y <= MaxY; Y++)
+			{
+				for (int32 X = MinX; X <= MaxX; X++)
+				{
+					if (!bTrivial)
+					{
+						const FVector2D CMin = Origin + FVector2D(X, Y) * CellSize;
+						const double D0 = FVector2D::DotProduct(N, CMin - A);
+						const double D1 = FVector2D::DotProduct(N, CMin + FVector2D(CellSize, 0) - A);
+						const double D2 = FVector2D::DotProduct(N, CMin + FVector2D(0, CellSize) - A);
+						const double D3 = FVector2D::DotProduct(N, CMin + FVector2D(CellSize, CellSize) - A);
+
+						if (FMath::Min(FMath::Min(D0, D1), FMath::Min(D2, D3)) > Padding) { continue; }
+						if (FMath::Max(FMath::Max(D0, D1), FMath::Max(D2, D3)) < -Padding) { continue; }
+					}
+
+					Func(X + Y * NumX);
+				}
+			}
+		};
+
+		// Count, prefix sum, then fill
+		CellStarts.Init(0, NumCells + 1);
+		for (int i = 0; i < NumSegments; i++) { ForEachSegmentCell(i, [&](const int32 Cell) { CellStarts[Cell + 1]++; }); }
+		for (int i = 0; i < NumCells; i++) { CellStarts[i + 1] += CellStarts[i]; }
+
+		TArray<int32> Cursors;
+		Cursors.Append(CellStarts.GetData(), NumCells);
+
+		CellSegments.SetNumUninitialized(CellStarts[NumCells]);
+		for (int i = 0; i < NumSegments; i++) { ForEachSegmentCell(i, [&](const int32 Cell) { CellSegments[Cursors[Cell]++] = i; }); }
+	}
+
+	int32 FSegmentGrid2D::GetCellIndex(const FVector2D& Position) const
+	{
+		const double FX = (Position.X - Origin.X) * InvCellSize;
+		const double FY = (Position.Y - Origin.Y) * InvCellSize;
+
+		if (FX < 0 || FY < 0 || FX > NumX || FY > NumY) { return -1; }
+
+		return FMath::Min(FMath::FloorToInt32(FX), NumX - 1) + FMath::Min(FMath::FloorToInt32(FY), NumY - 1) * NumX;
+	}
+
+	double FSegmentGrid2D::FindClosestSegment(const FVector2D& Position, int32& OutSegmentIndex) const
+	{
+		OutSegmentIndex = -1;
+		if (!IsValid()) { return MAX_dbl; }
+
+		const int32 CellIndex = GetCellIndex(Position);
+		if (CellIndex == -1) { return MAX_dbl; }
+
+		const double MaxDistSquared = FMath::Square(Padding);
+		double BestDistSquared = MAX_dbl;
+
+		ForEachSegmentInCell(
+			CellIndex, [&](const int32 SegmentIndex)
+			{
+				FVector2D A, B;
+				GetSegment(SegmentIndex, A, B);
+
+				const double DistSquared = FVector2D::DistSquared(Position, FMath::ClosestPointOnSegment2D(Position, A, B));
+				if (DistSquared > MaxDistSquared || DistSquared >= BestDistSquared) { return; }
+
+				BestDistSquared = DistSquared;
+				OutSegmentIndex = SegmentIndex;
+			});
+
+		return BestDistSquared;
+	}
+
+	FPolygonInclusionGrid::FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const int32 InMaxResolution)
+		: FSegmentGrid2D(InPolygon, true, 0, InMaxResolution)
+	{
+		if (InPolygon.Num() < 3 || !IsValid()) { return; }
+
+		const int32 NumCells = NumX * NumY;
+		CellStates.Init(0, NumCells);
+
+		for (int i = 0; i < NumCells; i++) { if (CellStarts[i + 1] > CellStarts[i]) { CellStates[i] |= GridInternal::Boundary; } }
+
+		// Exact inclusion of cell centers, one scanline per row
+
+		const int32 NumVtx = InPolygon.Num();
+		TArray<double> Crossings;
+
+		for (int32 Y = 0; Y < NumY; Y++)
+		{
+			const double CY = Origin.Y + (Y + 0.5) * CellSize;
+
+			Crossings.Reset();
+			for (int i = 0; i < NumVtx; i++)
+			{
+				const FVector2D& A = InPolygon[i];
+				const FVector2D& B = InPolygon[(i + 1) % NumVtx];
+				if ((A.Y > CY) == (B.Y > CY)) { continue; }
+				Crossings.Add(A.X + (CY - A.Y) * (B.X - A.X) / (B.Y - A.Y));
+			}
+
+			Crossings.Sort();
+
+			int32 NumCrossed = 0;
+			for (int32 X = 0; X < NumX; X++)
+			{
+				const double CX = Origin.X + (X + 0.5) * CellSize;
+				while (NumCrossed < Crossings.Num() && Crossings[NumCrossed] < CX) { NumCrossed++; }
+				if (NumCrossed & 1) { CellStates[X + Y * NumX] |= GridInternal::CenterInside; }
+			}
+		}
+	}
+
+	bool FPolygonInclusionGrid::IsInside(const FVector2D& Position) const
+	{
+		if (CellStates.IsEmpty()) { return Points->Num() >= 3 && FGeomTools2D::IsPointInPolygon(Position, *Points); }
+
+		const int32 CellIndex = GetCellIndex(Position);
+		if (CellIndex == -1) { return false; }
+
+		const uint8 State = CellStates[CellIndex];
+		bool bInside = (State & GridInternal::CenterInside) != 0;
+
+		if (!(State & GridInternal::Boundary)) { return bInside; }
+
+		// Walk from the cell center to the position, every crossed edge flips the state
+		const FVector2D Center = Origin + (FVector2D(CellIndex % NumX, CellIndex / NumX) + FVector2D(0.5, 0.5)) * CellSize;
+
+		ForEachSegmentInCell(
+			CellIndex, [&](const int32 SegmentIndex)
+			{
+				FVector2D A, B;
+				GetSegment(SegmentIndex, A, B);
+				if (GridInternal::SegmentsCross(Center, Position, A, B)) { bInside = !bInside; }
+			});
+
+		return bInside;
+	}
+}
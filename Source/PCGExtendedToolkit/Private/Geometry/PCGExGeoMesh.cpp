@@ -0,0 +1,477 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoMesh.h"
+
+namespace PCGExGeo
+{
+	void FGeoMesh::MakeDual()
+	{
+		if (Triangles.IsEmpty()) { return; }
+
+		PrepareDual();
+		BuildDual(PCGExMT::FScope(0, Triangles.Num()));
+		EndDual();
+	}
+
+	void FGeoMesh::MakeHollowDual()
+	{
+		if (Triangles.IsEmpty()) { return; }
+
+		PrepareHollowDual();
+		BuildHollowDual(PCGExMT::FScope(0, Triangles.Num()));
+		EndHollowDual();
+	}
+
+	void FGeoMesh::PrepareEdgeSlots(const bool bInBuildAdjacency)
+	{
+		const int32 NumSlots = CornerVtx.Num();
+		bBuildAdjacency = bInBuildAdjacency;
+
+		PCGEx::InitArray(SortedEdges, NumSlots);
+		PCGEx::InitArray(SlotEdges, NumSlots);
+
+		if (bBuildAdjacency)
+		{
+			PCGEx::InitArray(Triangles, NumSlots / 3);
+			PCGEx::InitArray(Adjacencies, NumSlots / 3);
+		}
+	}
+
+	void FGeoMesh::BuildEdgeSlots(const PCGExMT::FScope& Scope)
+	{
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const int32 Corner = i % 3;
+			const int32 Next = Corner == 2 ? i - 2 : i + 1;
+			SortedEdges[i] = FEdgeSlot{PCGEx::H64U(CornerVtx[i], CornerVtx[Next]), i};
+
+			if (bBuildAdjacency && Corner == 0) { Triangles[i / 3] = FIntVector3(CornerVtx[i], CornerVtx[i + 1], CornerVtx[i + 2]); }
+		}
+	}
+
+	void FGeoMesh::ResolveEdgeSlots(const PCGExMT::FScope& Scope)
+	{
+		const int32 NumSlots = SortedEdges.Num();
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const FEdgeSlot& First = SortedEdges[i];
+			if (i > 0 && SortedEdges[i - 1].Key == First.Key)
+			{
+				SlotEdges[First.Slot] = 0;
+				continue;
+			}
+
+			SlotEdges[First.Slot] = PCGEx::H64A(First.Key) != PCGEx::H64B(First.Key) ? First.Key : 0;
+
+			if (!bBuildAdjacency) { continue; }
+
+			int32 End = i + 1;
+			while (End < NumSlots && SortedEdges[End].Key == First.Key) { End++; }
+
+			// Matches the former (last, first) pair stored per edge : boundary edges have no neighbor,
+			// and triangles in between on non-manifold edges see the last one.
+			const int32 FirstTriangle = First.Slot / 3;
+			const int32 LastTriangle = SortedEdges[End - 1].Slot / 3;
+			const int32 Last = LastTriangle != FirstTriangle ? LastTriangle : -1;
+
+			for (int j = i; j < End; j++)
+			{
+				const int32 Slot = SortedEdges[j].Slot;
+				const int32 Triangle = Slot / 3;
+				Adjacencies[Triangle][Slot % 3] = Last == Triangle ? FirstTriangle : Last;
+			}
+		}
+	}
+
+	void FGeoMesh::PrepareDual()
+	{
+		const int32 NumTriangles = Triangles.Num();
+		PCGEx::InitArray(DualPositions, NumTriangles);
+		PCGEx::InitArray(SlotEdges, NumTriangles * 3);
+	}
+
+	void FGeoMesh::BuildDual(const PCGExMT::FScope& Scope)
+	{
+		// Dual edges are emitted by their lowest triangle only, which is where a serial pass would first meet them
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const FIntVector3& Triangle = Triangles[i];
+			DualPositions[i] = (Vertices[Triangle.X] + Vertices[Triangle.Y] + Vertices[Triangle.Z]) / 3;
+
+			const FIntVector3& Adjacency = Adjacencies[i];
+			for (int e = 0; e < 3; e++)
+			{
+				const int32 Other = Adjacency[e];
+				const bool bOwned = Other > i && (e == 0 || Adjacency[0] != Other) && (e < 2 || Adjacency[1] != Other);
+				SlotEdges[i * 3 + e] = bOwned ? PCGEx::H64U(i, Other) : 0;
+			}
+		}
+	}
+
+	void FGeoMesh::EndDual()
+	{
+		CompactSlotEdges();
+
+		Vertices = MoveTemp(DualPositions);
+
+		Triangles.Empty();
+		Adjacencies.Empty();
+	}
+
+	void FGeoMesh::PrepareHollowDual()
+	{
+		const int32 NumTriangles = Triangles.Num();
+		PCGEx::InitArray(Vertices, Vertices.Num() + NumTriangles);
+		PCGEx::InitArray(SlotEdges, NumTriangles * 3);
+	}
+
+	void FGeoMesh::BuildHollowDual(const PCGExMT::FScope& Scope)
+	{
+		const int32 StartIndex = Vertices.Num() - Triangles.Num();
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const FIntVector3& Triangle = Triangles[i];
+			const int32 E = StartIndex + i;
+			Vertices[E] = (Vertices[Triangle.X] + Vertices[Triangle.Y] + Vertices[Triangle.Z]) / 3;
+
+			// Centroids are unique per triangle, only degenerate triangles can yield duplicates
+			SlotEdges[i * 3] = PCGEx::H64U(E, Triangle.X);
+			SlotEdges[i * 3 + 1] = Triangle.Y != Triangle.X ? PCGEx::H64U(E, Triangle.Y) : 0;
+			SlotEdges[i * 3 + 2] = Triangle.Z != Triangle.X && Triangle.Z != Triangle.Y ? PCGEx::H64U(E, Triangle.Z) : 0;
+		}
+	}
+
+	void FGeoMesh::EndHollowDual()
+	{
+		CompactSlotEdges();
+
+		Triangles.Empty();
+		Adjacencies.Empty();
+	}
+
+	void FGeoMesh::CompactSlotEdges()
+	{
+		Edges.Reset(SlotEdges.Num());
+		for (const uint64 E : SlotEdges) { if (E) { Edges.Add(E); } }
+		Edges.Shrink();
+
+		SlotEdges.Empty();
+		SortedEdges.Empty();
+	}
+
+	void FGeoStaticMesh::ExtractMeshSynchronous()
+	{
+		if (bIsLoaded) { return; }
+		if (!bIsValid) { return; }
+
+		LoadSynchronous(false);
+	}
+
+	void FGeoStaticMesh::TriangulateMeshSynchronous()
+	{
+		if (bIsLoaded) { return; }
+		if (!bIsValid) { return; }
+
+		LoadSynchronous(true);
+	}
+
+	void FGeoStaticMesh::ExtractMeshAsync(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager, PCGExMT::FSimpleCallback&& OnComplete)
+	{
+		if (bIsLoaded || !bIsValid)
+		{
+			OnComplete();
+			return;
+		}
+
+		AsyncManager = InAsyncManager;
+		OnExtractionComplete = MoveTemp(OnComplete);
+
+		StartWeld();
+	}
+
+	void FGeoStaticMesh::LoadSynchronous(const bool bTriangulate)
+	{
+		const int32 NumCorners = PrepareWeld();
+		const PCGExMT::FScope CornersScope = PCGExMT::FScope(0, NumCorners);
+
+		HashCorners(CornersScope);
+		CornerKeys.Sort();
+		FindWeldRuns(CornersScope);
+		NumberVertices();
+		WeldCorners(CornersScope);
+
+		PrepareEdgeSlots(bTriangulate);
+		BuildEdgeSlots(CornersScope);
+		SortedEdges.Sort();
+		ResolveEdgeSlots(CornersScope);
+		CompactSlotEdges();
+
+		CornerVtx.Empty();
+		RunFirst.Empty();
+		IsFirst.Empty();
+
+		bIsLoaded = true;
+	}
+
+	int32 FGeoStaticMesh::PrepareWeld()
+	{
+		const FIndexArrayView& Indices = StaticMesh->GetRenderData()->LODResources[0].IndexBuffer.GetArrayView();
+		const int32 NumCorners = Indices.Num() - Indices.Num() % 3;
+
+		PCGEx::InitArray(CornerKeys, NumCorners);
+		PCGEx::InitArray(CornerVtx, NumCorners);
+		PCGEx::InitArray(RunFirst, NumCorners);
+		IsFirst.Init(0, NumCorners);
+
+		return NumCorners;
+	}
+
+	void FGeoStaticMesh::HashCorners(const PCGExMT::FScope& Scope)
+	{
+		const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
+		const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
+
+		PCGEX_SCOPE_LOOP(i) { CornerKeys[i] = PCGEx::H64(PCGEx::GH3(VertexBuffer.VertexPosition(Indices[i]), CWTolerance), i); }
+	}
+
+	void FGeoStaticMesh::FindWeldRuns(const PCGExMT::FScope& Scope)
+	{
+		const int32 NumCorners = CornerKeys.Num();
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const uint32 Hash = PCGEx::H64A(CornerKeys[i]);
+			if (i > 0 && PCGEx::H64A(CornerKeys[i - 1]) == Hash) { continue; }
+
+			const int32 First = PCGEx::H64B(CornerKeys[i]);
+			IsFirst[First] = 1;
+
+			for (int j = i; j < NumCorners && PCGEx::H64A(CornerKeys[j]) == Hash; j++) { RunFirst[PCGEx::H64B(CornerKeys[j])] = First; }
+		}
+	}
+
+	void FGeoStaticMesh::NumberVertices()
+	{
+		CornerKeys.Empty();
+
+		const int32 NumCorners = CornerVtx.Num();
+
+		int32 NumVtx = 0;
+		for (int i = 0; i < NumCorners; i++) { if (IsFirst[i]) { CornerVtx[i] = NumVtx++; } }
+
+		PCGEx::InitArray(Vertices, NumVtx);
+	}
+
+	void FGeoStaticMesh::WeldCorners(const PCGExMT::FScope& Scope)
+	{
+		const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
+		const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			if (IsFirst[i]) { Vertices[CornerVtx[i]] = FVector(VertexBuffer.VertexPosition(Indices[i])); }
+			else { CornerVtx[i] = CornerVtx[RunFirst[i]]; }
+		}
+	}
+
+	void FGeoStaticMesh::StartWeld()
+	{
+		const int32 NumCorners = PrepareWeld();
+		if (NumCorners == 0)
+		{
+			EndExtraction();
+			return;
+		}
+
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, HashCornersTask)
+
+		HashCornersTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->SortCornerKeys();
+			};
+
+		HashCornersTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->HashCorners(Scope);
+			};
+
+		HashCornersTask->StartSubLoops(NumCorners, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::SortCornerKeys()
+	{
+		PCGExMT::ParallelSort(
+			AsyncManager.Pin(), CornerKeys, TLess<uint64>(),
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->StartWeldRuns();
+			});
+	}
+
+	void FGeoStaticMesh::StartWeldRuns()
+	{
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, WeldRunsTask)
+
+		WeldRunsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->NumberVertices();
+				This->StartWeldCorners();
+			};
+
+		WeldRunsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->FindWeldRuns(Scope);
+			};
+
+		WeldRunsTask->StartSubLoops(CornerKeys.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::StartWeldCorners()
+	{
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, WeldCornersTask)
+
+		WeldCornersTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->RunFirst.Empty();
+				This->IsFirst.Empty();
+				This->StartEdges();
+			};
+
+		WeldCornersTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->WeldCorners(Scope);
+			};
+
+		WeldCornersTask->StartSubLoops(CornerVtx.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::StartEdges()
+	{
+		// Dual & hollow graphs are built on top of triangles & adjacency
+		PrepareEdgeSlots(DesiredTriangulationType != EPCGExTriangulationType::Raw);
+
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, BuildEdgeSlotsTask)
+
+		BuildEdgeSlotsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CornerVtx.Empty();
+				This->SortEdgeSlots();
+			};
+
+		BuildEdgeSlotsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->BuildEdgeSlots(Scope);
+			};
+
+		BuildEdgeSlotsTask->StartSubLoops(CornerVtx.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::SortEdgeSlots()
+	{
+		PCGExMT::ParallelSort(
+			AsyncManager.Pin(), SortedEdges, TLess<FEdgeSlot>(),
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->StartResolveEdges();
+			});
+	}
+
+	void FGeoStaticMesh::StartResolveEdges()
+	{
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, ResolveEdgeSlotsTask)
+
+		ResolveEdgeSlotsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CompactSlotEdges();
+				This->StartDual();
+			};
+
+		ResolveEdgeSlotsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ResolveEdgeSlots(Scope);
+			};
+
+		ResolveEdgeSlotsTask->StartSubLoops(SortedEdges.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::StartDual()
+	{
+		const bool bHollow = DesiredTriangulationType == EPCGExTriangulationType::Hollow;
+		if (Triangles.IsEmpty() || (!bHollow && DesiredTriangulationType != EPCGExTriangulationType::Dual))
+		{
+			EndExtraction();
+			return;
+		}
+
+		if (bHollow) { PrepareHollowDual(); }
+		else { PrepareDual(); }
+
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, BuildDualTask)
+
+		BuildDualTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, bHollow]()
+			{
+				PCGEX_ASYNC_THIS
+				if (bHollow) { This->EndHollowDual(); }
+				else { This->EndDual(); }
+				This->EndExtraction();
+			};
+
+		BuildDualTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, bHollow](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				if (bHollow) { This->BuildHollowDual(Scope); }
+				else { This->BuildDual(Scope); }
+			};
+
+		BuildDualTask->StartSubLoops(Triangles.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FGeoStaticMesh::EndExtraction()
+	{
+		CornerKeys.Empty();
+		CornerVtx.Empty();
+		RunFirst.Empty();
+		IsFirst.Empty();
+
+		bIsLoaded = true;
+
+		PCGExMT::FSimpleCallback Callback = MoveTemp(OnExtractionComplete);
+		OnExtractionComplete = nullptr;
+		if (Callback) { Callback(); }
+	}
+}
@@ -0,0 +1,369 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Geometry/PCGExGeoVoronoi.h"
+
+namespace PCGExGeo
+{
+	namespace VoronoiClipping
+	{
+		// Compact per-position neighborhood from Delaunay edges
+		static void BuildNeighborhood(const int32 NumPositions, const TSet<uint64>& InEdges, TArray<int32>& OutOffsets, TArray<int32>& OutNeighbors)
+		{
+			OutOffsets.Init(0, NumPositions + 1);
+			for (const uint64 Edge : InEdges)
+			{
+				OutOffsets[PCGEx::H64A(Edge) + 1]++;
+				OutOffsets[PCGEx::H64B(Edge) + 1]++;
+			}
+
+			for (int i = 0; i < NumPositions; i++) { OutOffsets[i + 1] += OutOffsets[i]; }
+
+			TArray<int32> Cursor = OutOffsets;
+			OutNeighbors.SetNumUninitialized(OutOffsets[NumPositions]);
+
+			for (const uint64 Edge : InEdges)
+			{
+				const int32 A = PCGEx::H64A(Edge);
+				const int32 B = PCGEx::H64B(Edge);
+				OutNeighbors[Cursor[A]++] = B;
+				OutNeighbors[Cursor[B]++] = A;
+			}
+		}
+
+		// Sutherland-Hodgman against successive bisectors; each vertex carries the source of its outgoing edge
+		static void ClipCell2D(const int32 Site, const TArray<FVector2D>& Positions, const TConstArrayView<int32> Neighbors, const FBox2D& Box, TArray<FVector2D>& OutPolygon, TArray<int32>& OutSources)
+		{
+			OutPolygon = {Box.Min, FVector2D(Box.Max.X, Box.Min.Y), Box.Max, FVector2D(Box.Min.X, Box.Max.Y)};
+			OutSources = {-1, -1, -1, -1};
+
+			TArray<FVector2D> NextPolygon;
+			TArray<int32> NextSources;
+
+			const FVector2D& P = Positions[Site];
+
+			for (const int32 Other : Neighbors)
+			{
+				const FVector2D N = Positions[Other] - P;
+				if (N.IsNearlyZero()) { continue; }
+
+				const double C = N.Dot((P + Positions[Other]) * 0.5);
+				const int32 Num = OutPolygon.Num();
+
+				NextPolygon.Reset();
+				NextSources.Reset();
+
+				for (int k = 0; k < Num; k++)
+				{
+					const FVector2D& A = OutPolygon[k];
+					const FVector2D& B = OutPolygon[(k + 1) % Num];
+
+					const double DA = N.Dot(A) - C;
+					const double DB = N.Dot(B) - C;
+					const bool bInA = DA <= 0;
+					const bool bInB = DB <= 0;
+
+					if (bInA)
+					{
+						NextPolygon.Add(A);
+						NextSources.Add(OutSources[k]);
+					}
+
+					if (bInA != bInB)
+					{
+						NextPolygon.Add(A + (B - A) * (DA / (DA - DB)));
+						NextSources.Add(bInA ? Other : OutSources[k]);
+					}
+				}
+
+				Swap(OutPolygon, NextPolygon);
+				Swap(OutSources, NextSources);
+
+				if (OutPolygon.Num() < 3)
+				{
+					OutPolygon.Reset();
+					OutSources.Reset();
+					return;
+				}
+			}
+		}
+
+		static void ClipCell3D(const int32 Site, const TArrayView<FVector>& Positions, const TConstArrayView<int32> Neighbors, const FBox& Box, TArray<FRawFace>& OutFaces)
+		{
+			const FVector& Mn = Box.Min;
+			const FVector& Mx = Box.Max;
+
+			const FVector Corners[8] = {
+				FVector(Mn.X, Mn.Y, Mn.Z), FVector(Mx.X, Mn.Y, Mn.Z), FVector(Mx.X, Mx.Y, Mn.Z), FVector(Mn.X, Mx.Y, Mn.Z),
+				FVector(Mn.X, Mn.Y, Mx.Z), FVector(Mx.X, Mn.Y, Mx.Z), FVector(Mx.X, Mx.Y, Mx.Z), FVector(Mn.X, Mx.Y, Mx.Z)
+			};
+
+			constexpr int32 BoxFaces[6][4] = {{0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4}, {2, 3, 7, 6}, {1, 2, 6, 5}, {0, 4, 7, 3}};
+
+			OutFaces.Reset(6);
+			for (int f = 0; f < 6; f++)
+			{
+				FRawFace& Face = OutFaces.Emplace_GetRef();
+				for (int c = 0; c < 4; c++) { Face.Points.Add(Corners[BoxFaces[f][c]]); }
+			}
+
+			TArray<FVector> Clipped;
+			TArray<FVector> Cap;
+			TArray<TPair<double, int32>> Angles;
+
+			const FVector& P = Positions[Site];
+
+			for (const int32 Other : Neighbors)
+			{
+				const FVector N = Positions[Other] - P;
+				if (N.IsNearlyZero()) { continue; }
+
+				const double C = N.Dot((P + Positions[Other]) * 0.5);
+
+				Cap.Reset();
+
+				for (int f = 0; f < OutFaces.Num(); f++)
+				{
+					TArray<FVector>& Points = OutFaces[f].Points;
+					const int32 Num = Points.Num();
+
+					Clipped.Reset();
+
+					for (int k = 0; k < Num; k++)
+					{
+						const FVector& A = Points[k];
+						const FVector& B = Points[(k + 1) % Num];
+
+						const double DA = N.Dot(A) - C;
+						const double DB = N.Dot(B) - C;
+						const bool bInA = DA <= 0;
+
+						if (bInA) { Clipped.Add(A); }
+						if (bInA != (DB <= 0))
+						{
+							const FVector I = A + (B - A) * (DA / (DA - DB));
+							Clipped.Add(I);
+							Cap.Add(I);
+						}
+					}
+
+					if (Clipped.Num() < 3)
+					{
+						OutFaces.RemoveAt(f, EAllowShrinking::No);
+						f--;
+						continue;
+					}
+
+					Points = Clipped;
+				}
+
+				if (OutFaces.IsEmpty()) { return; }
+				if (Cap.Num() < 3) { continue; }
+
+				// Order cap points around their centroid on the bisector plane
+				FVector Center = FVector::ZeroVector;
+				for (const FVector& V : Cap) { Center += V; }
+				Center /= Cap.Num();
+
+				FVector U;
+				FVector V;
+				N.GetSafeNormal().FindBestAxisVectors(U, V);
+
+				Angles.Reset(Cap.Num());
+				for (int i = 0; i < Cap.Num(); i++)
+				{
+					const FVector D = Cap[i] - Center;
+					Angles.Emplace(FMath::Atan2(D.Dot(V), D.Dot(U)), i);
+				}
+
+				Angles.Sort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
+
+				FRawFace& CapFace = OutFaces.Emplace_GetRef();
+				CapFace.Neighbor = Other;
+				CapFace.Points.Reserve(Cap.Num());
+				for (const TPair<double, int32>& Angle : Angles) { CapFace.Points.Add(Cap[Angle.Value]); }
+			}
+		}
+
+		// Weld raw faces into shared vertices, in cell order
+		static void Weld(TArray<TArray<FRawFace>>& RawCells, const int32 MinFaceVertices, const double WeldTolerance, FVoronoiClippedCells& OutCells)
+		{
+			const FVector CWTolerance = FVector(1 / FMath::Max(WeldTolerance, UE_DOUBLE_SMALL_NUMBER));
+
+			TMap<FInt64Vector3, int32> VertexMap;
+			OutCells.Cells.SetNum(RawCells.Num());
+
+			TArray<int32> Indices;
+
+			for (int c = 0; c < RawCells.Num(); c++)
+			{
+				FVoronoiCell& Cell = OutCells.Cells[c];
+				Cell.Site = c;
+
+				for (FRawFace& RawFace : RawCells[c])
+				{
+					Indices.Reset(RawFace.Points.Num());
+
+					for (const FVector& Point : RawFace.Points)
+					{
+						const FInt64Vector3 Key = PCGEx::I643(Point, CWTolerance);
+						int32 Index = -1;
+
+						if (const int32* Found = VertexMap.Find(Key)) { Index = *Found; }
+						else
+						{
+							Index = OutCells.Vertices.Add(Point);
+							VertexMap.Add(Key, Index);
+						}
+
+						if (Indices.IsEmpty() || Indices.Last() != Index) { Indices.Add(Index); }
+					}
+
+					while (Indices.Num() > 1 && Indices.Last() == Indices[0]) { Indices.Pop(EAllowShrinking::No); }
+					if (Indices.Num() < MinFaceVertices) { continue; }
+
+					FVoronoiCellFace& Face = Cell.Faces.Emplace_GetRef();
+					Face.Vertices = Indices;
+					Face.Neighbor = RawFace.Neighbor;
+
+					if (MinFaceVertices == 2) { OutCells.Edges.Add(PCGEx::H64U(Indices[0], Indices[1])); }
+					else { for (int i = 0; i < Indices.Num(); i++) { OutCells.Edges.Add(PCGEx::H64U(Indices[i], Indices[(i + 1) % Indices.Num()])); } }
+
+					if (Face.Neighbor != -1) { OutCells.Adjacency.Add(PCGEx::H64U(c, Face.Neighbor)); }
+				}
+
+				RawCells[c].Empty();
+			}
+		}
+	}
+
+	bool TVoronoi2::ProcessClipped(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const FBox& Bounds, const double WeldTolerance)
+	{
+		if (!BeginClipped(Positions, ProjectionDetails, Bounds, WeldTolerance)) { return IsValid; }
+
+		ClipCells(PCGExMT::FScope(0, GetNumClipSites()));
+		EndClipped();
+
+		return IsValid;
+	}
+
+	bool TVoronoi2::BeginClipped(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const FBox& Bounds, const double WeldTolerance)
+	{
+		Clear();
+
+		Delaunay = MakeUnique<TDelaunay2>();
+		if (!Delaunay->Process(Positions, ProjectionDetails))
+		{
+			Clear();
+			return IsValid;
+		}
+
+		const int32 NumPositions = Positions.Num();
+
+		ProjectionDetails.Project(Positions, ClipPositions2D);
+		ClipProjection = ProjectionDetails.ProjectionQuat;
+		ClipWeldTolerance = WeldTolerance;
+
+		ClipDepth = 0;
+		for (const FVector& Position : Positions) { ClipDepth += ClipProjection.UnrotateVector(Position).Z; }
+		ClipDepth /= NumPositions;
+
+		ClipBox2D = FBox2D(ForceInit);
+		for (int i = 0; i < 8; i++)
+		{
+			const FVector Corner = FVector(i & 1 ? Bounds.Max.X : Bounds.Min.X, i & 2 ? Bounds.Max.Y : Bounds.Min.Y, i & 4 ? Bounds.Max.Z : Bounds.Min.Z);
+			ClipBox2D += FVector2D(ClipProjection.UnrotateVector(Corner));
+		}
+
+		VoronoiClipping::BuildNeighborhood(NumPositions, Delaunay->DelaunayEdges, ClipOffsets, ClipNeighbors);
+		RawCells.SetNum(NumPositions);
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	void TVoronoi2::ClipCells(const PCGExMT::FScope& Scope)
+	{
+		TArray<FVector2D> Polygon;
+		TArray<int32> Sources;
+
+		PCGEX_SCOPE_LOOP(Site)
+		{
+			VoronoiClipping::ClipCell2D(Site, ClipPositions2D, MakeArrayView(ClipNeighbors.GetData() + ClipOffsets[Site], ClipOffsets[Site + 1] - ClipOffsets[Site]), ClipBox2D, Polygon, Sources);
+
+			const int32 Num = Polygon.Num();
+			TArray<VoronoiClipping::FRawFace>& Faces = RawCells[Site];
+			Faces.Reserve(Num);
+
+			for (int k = 0; k < Num; k++)
+			{
+				VoronoiClipping::FRawFace& Face = Faces.Emplace_GetRef();
+				Face.Neighbor = Sources[k];
+				Face.Points.Add(ClipProjection.RotateVector(FVector(Polygon[k], ClipDepth)));
+				Face.Points.Add(ClipProjection.RotateVector(FVector(Polygon[(k + 1) % Num], ClipDepth)));
+			}
+		}
+	}
+
+	void TVoronoi2::EndClipped()
+	{
+		VoronoiClipping::Weld(RawCells, 2, ClipWeldTolerance, ClippedCells);
+
+		RawCells.Empty();
+		ClipPositions2D.Empty();
+		ClipOffsets.Empty();
+		ClipNeighbors.Empty();
+	}
+
+	bool TVoronoi3::ProcessClipped(const TArrayView<FVector>& Positions, const FBox& Bounds, const double WeldTolerance)
+	{
+		if (!BeginClipped(Positions, Bounds, WeldTolerance)) { return IsValid; }
+
+		ClipCells(PCGExMT::FScope(0, GetNumClipSites()));
+		EndClipped();
+
+		return IsValid;
+	}
+
+	bool TVoronoi3::BeginClipped(const TArrayView<FVector>& Positions, const FBox& Bounds, const double WeldTolerance)
+	{
+		Clear();
+
+		Delaunay = MakeUnique<TDelaunay3>();
+		if (!Delaunay->Process<false, false>(Positions))
+		{
+			Clear();
+			return IsValid;
+		}
+
+		const int32 NumPositions = Positions.Num();
+
+		ClipPositions = Positions;
+		ClipBounds = Bounds;
+		ClipWeldTolerance = WeldTolerance;
+
+		VoronoiClipping::BuildNeighborhood(NumPositions, Delaunay->DelaunayEdges, ClipOffsets, ClipNeighbors);
+		RawCells.SetNum(NumPositions);
+
+		IsValid = true;
+		return IsValid;
+	}
+
+	void TVoronoi3::ClipCells(const PCGExMT::FScope& Scope)
+	{
+		PCGEX_SCOPE_LOOP(Site)
+		{
+			VoronoiClipping::ClipCell3D(Site, ClipPositions, MakeArrayView(ClipNeighbors.GetData() + ClipOffsets[Site], ClipOffsets[Site + 1] - ClipOffsets[Site]), ClipBounds, RawCells[Site]);
+		}
+	}
+
+	void TVoronoi3::EndClipped()
+	{
+		VoronoiClipping::Weld(RawCells, 3, ClipWeldTolerance, ClippedCells);
+
+		RawCells.Empty();
+		ClipPositions = TArrayView<FVector>();
+		ClipOffsets.Empty();
+		ClipNeighbors.Empty();
+	}
+}
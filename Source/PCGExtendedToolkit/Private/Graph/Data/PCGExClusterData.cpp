@@ -8,6 +8,13 @@
 #include "PCGExGlobalSettings.h"
 #include "Graph/PCGExCluster.h"
 
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
 UPCGSpatialData* UPCGExClusterNodesData::CopyInternal(FPCGContext* Context) const
 {
 	PCGEX_NEW_CUSTOM_POINT_DATA(UPCGExClusterNodesData)
@@ -66,3 +73,224 @@ TSharedPtr<PCGExCluster::FCluster> PCGExClusterData::TryGetCachedCluster(const T
 
 	return nullptr;
 }
+
+namespace PCGExClusterData
+{
+	namespace PersistentCache
+	{
+		constexpr uint32 Magic = 0x43584750; // PGXC
+		constexpr uint32 Version = 1;
+
+		FString GetDirectory() { return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("ClusterCache")); }
+		FString GetFilePath(const uint64 Key) { return FPaths::Combine(GetDirectory(), FString::Printf(TEXT("%016llx.pcgexcluster"), Key)); }
+
+		void Prune(const int64 MaxBytes)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::PersistentCache::Prune);
+
+			struct FEntry
+			{
+				FString Path;
+				FDateTime TimeStamp;
+				int64 Size = 0;
+			};
+
+			TArray<FEntry> Entries;
+			int64 TotalSize = 0;
+
+			IFileManager::Get().IterateDirectoryStat(
+				*GetDirectory(), [&](const TCHAR* Path, const FFileStatData& StatData)
+				{
+					if (StatData.bIsDirectory || FPaths::GetExtension(Path) != TEXT("pcgexcluster")) { return true; }
+					Entries.Add(FEntry{Path, StatData.ModificationTime, StatData.FileSize});
+					TotalSize += StatData.FileSize;
+					return true;
+				});
+
+			if (TotalSize <= MaxBytes) { return; }
+
+			// Timestamps are refreshed on load, so the oldest ones are the least recently used
+			Entries.Sort([](const FEntry& A, const FEntry& B) { return A.TimeStamp < B.TimeStamp; });
+
+			for (const FEntry& Entry : Entries)
+			{
+				if (TotalSize <= MaxBytes) { break; }
+				if (IFileManager::Get().Delete(*Entry.Path, false, false, true)) { TotalSize -= Entry.Size; }
+			}
+		}
+
+		uint64 HashEndpoints(const TSharedRef<PCGExData::FPointIO>& InIO, const FName AttributeName, const uint64 Seed)
+		{
+			const TUniquePtr<PCGExData::TArrayBuffer<int64>> Buffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(InIO, AttributeName);
+			if (!Buffer->InitForRead()) { return 0; }
+
+			const TArray<int64>& Values = *Buffer->GetInValues().Get();
+			return CityHash64WithSeed(reinterpret_cast<const char*>(Values.GetData()), Values.Num() * sizeof(int64), Seed);
+		}
+	}
+
+	uint64 ComputePersistentKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::ComputePersistentKey);
+
+		uint64 Key = PCGEx::H64(VtxIO->GetNum(), EdgeIO->GetNum());
+
+		const uint64 VtxHash = PersistentCache::HashEndpoints(VtxIO, PCGExGraph::Attr_PCGExVtxIdx, Key ^ PersistentCache::Version);
+		if (!VtxHash) { return 0; }
+
+		const uint64 EdgeHash = PersistentCache::HashEndpoints(EdgeIO, PCGExGraph::Attr_PCGExEdgeIdx, VtxHash);
+		if (!EdgeHash) { return 0; }
+
+		return EdgeHash;
+	}
+
+	TSharedPtr<PCGExCluster::FCluster> TryLoadPersistentCluster(
+		const uint64 Key, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO,
+		const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::TryLoadPersistentCluster);
+
+		if (!Key) { return nullptr; }
+
+		const FString FilePath = PersistentCache::GetFilePath(Key);
+
+		TArray<uint8> Bytes;
+		if (!IFileManager::Get().FileExists(*FilePath) || !FFileHelper::LoadFileToArray(Bytes, *FilePath)) { return nullptr; }
+
+		FMemoryReader Ar(Bytes);
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint64 StoredKey = 0;
+		int32 NumRawVtx = 0;
+		int32 NumRawEdges = 0;
+
+		Ar << Magic << Version << StoredKey << NumRawVtx << NumRawEdges;
+
+		if (Ar.IsError() || Magic != PersistentCache::Magic || Version != PersistentCache::Version || StoredKey != Key ||
+			NumRawVtx != VtxIO->GetNum() || NumRawEdges != EdgeIO->GetNum())
+		{
+			return nullptr;
+		}
+
+		PCGEX_MAKE_SHARED(NewCluster, PCGExCluster::FCluster, VtxIO, EdgeIO, InNodeIndexLookup)
+		NewCluster->NumRawVtx = NumRawVtx;
+		NewCluster->NumRawEdges = NumRawEdges;
+		NewCluster->VtxTransforms = VtxIO->GetIn()->GetConstTransformValueRange();
+
+		TArray<PCGExCluster::FNode>& Nodes = *NewCluster->Nodes.Get();
+		TArray<PCGExGraph::FEdge>& Edges = *NewCluster->Edges.Get();
+
+		int32 NumNodes = 0;
+		Ar << NumNodes;
+		if (Ar.IsError() || NumNodes < 0 || NumNodes > NumRawVtx) { return nullptr; }
+
+		Nodes.Reserve(NumNodes);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			int32 PointIndex = -1;
+			int32 NumLinks = 0;
+			Ar << PointIndex << NumLinks;
+
+			if (Ar.IsError() || PointIndex < 0 || PointIndex >= NumRawVtx || NumLinks < 0 || NumLinks > NumRawEdges) { return nullptr; }
+
+			PCGExCluster::FNode& Node = Nodes.Emplace_GetRef(i, PointIndex);
+			Node.Links.SetNumUninitialized(NumLinks);
+			for (PCGExGraph::FLink& Lk : Node.Links) { Ar << Lk.Node << Lk.Edge; }
+
+			NewCluster->Bounds += NewCluster->VtxTransforms[PointIndex].GetLocation();
+		}
+
+		int32 NumEdges = 0;
+		Ar << NumEdges;
+		if (Ar.IsError() || NumEdges != NumRawEdges) { return nullptr; }
+
+		const int32 EdgeIOIndex = EdgeIO->IOIndex;
+		PCGEx::InitArray(Edges, NumEdges);
+		for (int i = 0; i < NumEdges; i++)
+		{
+			uint32 Start = 0;
+			uint32 End = 0;
+			Ar << Start << End;
+			if (Start >= static_cast<uint32>(NumRawVtx) || End >= static_cast<uint32>(NumRawVtx)) { return nullptr; }
+			Edges[i] = PCGExGraph::FEdge(i, Start, End, i, EdgeIOIndex);
+		}
+
+		if (Ar.IsError()) { return nullptr; }
+
+		// Validate links last, now that all counts are known
+		for (const PCGExCluster::FNode& Node : Nodes)
+		{
+			for (const PCGExGraph::FLink Lk : Node.Links)
+			{
+				if (!Nodes.IsValidIndex(Lk.Node) || !Edges.IsValidIndex(Lk.Edge)) { return nullptr; }
+			}
+		}
+
+		// Only touch the shared lookup once the whole file is known to be valid,
+		// so a rejected file doesn't leave it half-written for the regular build
+		for (const PCGExCluster::FNode& Node : Nodes) { InNodeIndexLookup->GetMutable(Node.PointIndex) = Node.Index; }
+
+		NewCluster->Bounds = NewCluster->Bounds.ExpandBy(10);
+
+		// Mark as recently used
+		IFileManager::Get().SetTimeStamp(*FilePath, FDateTime::UtcNow());
+
+		return NewCluster;
+	}
+
+	bool SavePersistentCluster(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InCluster)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterData::SavePersistentCluster);
+
+		if (!Key) { return false; }
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes);
+
+		uint32 Magic = PersistentCache::Magic;
+		uint32 Version = PersistentCache::Version;
+		uint64 StoredKey = Key;
+		int32 NumRawVtx = InCluster->NumRawVtx;
+		int32 NumRawEdges = InCluster->NumRawEdges;
+
+		Ar << Magic << Version << StoredKey << NumRawVtx << NumRawEdges;
+
+		TArray<PCGExCluster::FNode>& Nodes = *InCluster->Nodes.Get();
+		TArray<PCGExGraph::FEdge>& Edges = *InCluster->Edges.Get();
+
+		int32 NumNodes = Nodes.Num();
+		Ar << NumNodes;
+		for (PCGExCluster::FNode& Node : Nodes)
+		{
+			int32 NumLinks = Node.Links.Num();
+			Ar << Node.PointIndex << NumLinks;
+			for (PCGExGraph::FLink& Lk : Node.Links) { Ar << Lk.Node << Lk.Edge; }
+		}
+
+		int32 NumEdges = Edges.Num();
+		Ar << NumEdges;
+		for (PCGExGraph::FEdge& Edge : Edges) { Ar << Edge.Start << Edge.End; }
+
+		// Write to a unique temp file first, concurrent processors may be saving the same key
+		const FString FilePath = PersistentCache::GetFilePath(Key);
+		const FString TempPath = FilePath + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+
+		IFileManager::Get().MakeDirectory(*PersistentCache::GetDirectory(), true);
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath)) { return false; }
+		if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return false;
+		}
+
+		PersistentCache::Prune(static_cast<int64>(GetDefault<UPCGExGlobalSettings>()->PersistentClusterCacheMaxSizeMB) * 1024 * 1024);
+
+		return true;
+	}
+
+	void ClearPersistentCache()
+	{
+		IFileManager::Get().DeleteDirectory(*PersistentCache::GetDirectory(), false, true);
+	}
+}
@@ -82,7 +82,7 @@ namespace PCGExConvexHull
 
 		Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
 
-		if (!Delaunay->Process<false, true>(ActivePositions))
+		if (!Delaunay->Triangulate(ActivePositions))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generates no results. Are points coplanar? If so, use Convex Hull 2D instead."));
 			return false;
@@ -91,14 +91,44 @@ namespace PCGExConvexHull
 		ActivePositions.Empty();
 
 		PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-		Edges = Delaunay->DelaunayEdges.Array();
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
-		StartParallelLoopForRange(Edges.Num());
+
+		if (Delaunay->NumSiteChunks == 0)
+		{
+			OnSitesExtracted();
+			return true;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ExtractSitesTask)
+
+		ExtractSitesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->OnSitesExtracted();
+			};
+
+		ExtractSitesTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->Delaunay->ExtractSites<true>(Index);
+			};
+
+		ExtractSitesTask->StartIterations(Delaunay->NumSiteChunks, 1);
 
 		return true;
 	}
 
+	void FProcessor::OnSitesExtracted()
+	{
+		Delaunay->EndExtraction<false, true>();
+
+		Edges = Delaunay->DelaunayEdges.Array();
+		StartParallelLoopForRange(Edges.Num());
+	}
+
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		PCGEX_SCOPE_LOOP(Index)
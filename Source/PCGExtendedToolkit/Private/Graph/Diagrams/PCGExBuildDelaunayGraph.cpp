@@ -93,16 +93,11 @@ namespace PCGExBuildDelaunay
 
 		// Build delaunay
 
-		TArray<FVector> ActivePositions;
 		PCGExGeo::PointsToPositions(PointDataFacade->Source->GetIn(), ActivePositions);
 
 		Delaunay = MakeUnique<PCGExGeo::TDelaunay3>();
 
-		bool bProcessed = false;
-		if (Settings->bMarkHull) { bProcessed = Delaunay->Process<false, true>(ActivePositions); }
-		else { bProcessed = Delaunay->Process<false, false>(ActivePositions); }
-
-		if (!bProcessed)
+		if (!Delaunay->Triangulate(ActivePositions))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generated invalid results. Are points coplanar? If so, use Delaunay 2D instead."));
 			return false;
@@ -110,6 +105,39 @@ namespace PCGExBuildDelaunay
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::Duplicate)) { return false; }
 
+		if (Delaunay->NumSiteChunks == 0)
+		{
+			OnSitesExtracted();
+			return true;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ExtractSitesTask)
+
+		ExtractSitesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->OnSitesExtracted();
+			};
+
+		ExtractSitesTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				if (This->Settings->bMarkHull) { This->Delaunay->ExtractSites<true>(Index); }
+				else { This->Delaunay->ExtractSites<false>(Index); }
+			};
+
+		ExtractSitesTask->StartIterations(Delaunay->NumSiteChunks, 1);
+
+		return true;
+	}
+
+	void FProcessor::OnSitesExtracted()
+	{
+		if (Settings->bMarkHull) { Delaunay->EndExtraction<false, true>(); }
+		else { Delaunay->EndExtraction<false, false>(); }
+
 		if (Settings->bUrquhart)
 		{
 			if (Settings->bOutputSites && Settings->bMergeUrquhartSites) { Delaunay->RemoveLongestEdges(ActivePositions, UrquhartEdges); }
@@ -130,8 +158,6 @@ namespace PCGExBuildDelaunay
 		GraphBuilder->CompileAsync(AsyncManager, false);
 
 		if (!Settings->bMarkHull && !Settings->bOutputSites) { Delaunay.Reset(); }
-
-		return true;
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
@@ -143,7 +169,7 @@ namespace PCGExBuildDelaunay
 
 	void FProcessor::CompleteWork()
 	{
-		if (!GraphBuilder->bCompiledSuccessfully)
+		if (!GraphBuilder || !GraphBuilder->bCompiledSuccessfully)
 		{
 			bIsProcessorValid = false;
 			PCGEX_CLEAR_IO_VOID(PointDataFacade->Source)
@@ -100,12 +100,11 @@ namespace PCGExBuildDelaunay2D
 
 		// Build delaunay
 
-		TArray<FVector> ActivePositions;
 		PCGExGeo::PointsToPositions(PointDataFacade->Source->GetIn(), ActivePositions);
 
 		Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
 
-		if (!Delaunay->Process(ActivePositions, ProjectionDetails))
+		if (!Delaunay->Triangulate(ActivePositions, ProjectionDetails))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generated invalid results."));
 			return false;
@@ -113,6 +112,37 @@ namespace PCGExBuildDelaunay2D
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::Duplicate)) { return false; }
 
+		if (Delaunay->NumSiteChunks == 0)
+		{
+			OnSitesExtracted();
+			return true;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ExtractSitesTask)
+
+		ExtractSitesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->OnSitesExtracted();
+			};
+
+		ExtractSitesTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->Delaunay->ExtractSites(Index);
+			};
+
+		ExtractSitesTask->StartIterations(Delaunay->NumSiteChunks, 1);
+
+		return true;
+	}
+
+	void FProcessor::OnSitesExtracted()
+	{
+		Delaunay->EndExtraction();
+
 		if (Settings->bUrquhart)
 		{
 			if (Settings->bOutputSites && Settings->UrquhartSitesMerge != EPCGExUrquhartSiteMergeMode::None)
@@ -144,8 +174,6 @@ namespace PCGExBuildDelaunay2D
 		GraphBuilder->CompileAsync(AsyncManager, false);
 
 		if (!Settings->bMarkHull && !Settings->bOutputSites) { Delaunay.Reset(); }
-
-		return true;
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
@@ -157,9 +185,7 @@ namespace PCGExBuildDelaunay2D
 
 	void FProcessor::CompleteWork()
 	{
-		if (!GraphBuilder) { return; }
-
-		if (!GraphBuilder->bCompiledSuccessfully)
+		if (!GraphBuilder || !GraphBuilder->bCompiledSuccessfully)
 		{
 			bIsProcessorValid = false;
 			PCGEX_CLEAR_IO_VOID(PointDataFacade->Source)
@@ -23,7 +23,7 @@ TArray<FPCGPinProperties> UPCGExBuildVoronoiGraphSettings::OutputPinProperties()
 {
 	TArray<FPCGPinProperties> PinProperties = Super::OutputPinProperties();
 	PCGEX_PIN_POINTS(PCGExGraph::OutputEdgesLabel, "Point data representing edges.", Required, {})
-	//PCGEX_PIN_POINTS(PCGExGraph::OutputSitesLabel, "Complete delaunay sites.", Required, {})
+	if (bClipToBounds) { PCGEX_PIN_POINTS(PCGExGraph::OutputSitesLabel, "Sites with their clipped cell information.", Required, {}) }
 	return PinProperties;
 }
 
@@ -40,6 +40,17 @@ bool FPCGExBuildVoronoiGraphElement::Boot(FPCGExContext* InContext) const
 	Context->SitesOutput = MakeShared<PCGExData::FPointIOCollection>(Context);
 	Context->SitesOutput->OutputPin = PCGExGraph::OutputSitesLabel;
 
+	if (Settings->bClipToBounds)
+	{
+		if (Settings->bWriteCellNeighborCount) { PCGEX_VALIDATE_NAME(Settings->CellNeighborCountAttributeName) }
+		if (Settings->bWriteCellOnBounds) { PCGEX_VALIDATE_NAME(Settings->CellOnBoundsAttributeName) }
+
+		for (const TSharedPtr<PCGExData::FPointIO>& IO : Context->MainPoints->Pairs)
+		{
+			Context->SitesOutput->Emplace_GetRef(IO, PCGExData::EIOInit::NoInit);
+		}
+	}
+
 	return true;
 }
 
@@ -63,7 +74,6 @@ bool FPCGExBuildVoronoiGraphElement::ExecuteInternal(
 					return false;
 				}
 
-				Context->SitesOutput->Emplace_GetRef(Entry, PCGExData::EIOInit::New);
 				return true;
 			},
 			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExBuildVoronoi::FProcessor>>& NewBatch)
@@ -78,7 +88,7 @@ bool FPCGExBuildVoronoiGraphElement::ExecuteInternal(
 	PCGEX_POINTS_BATCH_PROCESSING(PCGEx::State_Done)
 
 	Context->MainPoints->StageOutputs();
-	//Context->SitesOutput->OutputToContext();
+	if (Settings->bClipToBounds) { Context->SitesOutput->StageOutputs(); }
 	Context->MainBatch->Output();
 
 	return Context->TryComplete();
@@ -98,21 +108,50 @@ namespace PCGExBuildVoronoi
 
 		// Build voronoi
 
-		TArray<FVector> ActivePositions;
 		PCGExGeo::PointsToPositions(PointDataFacade->Source->GetIn(), ActivePositions);
 
 		Voronoi = MakeUnique<PCGExGeo::TVoronoi3>();
 
-		if (!Voronoi->Process(ActivePositions))
+		const FBox Bounds = PointDataFacade->Source->GetIn()->GetBounds().ExpandBy(Settings->ExpandBounds);
+
+		if (Settings->bClipToBounds ? !Voronoi->BeginClipped(ActivePositions, Bounds) : !Voronoi->Process(ActivePositions))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generated invalid results. Are points coplanar? If so, use Voronoi 2D instead."));
 			return false;
 		}
 
-		ActivePositions.Empty();
-
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
-		const FBox Bounds = PointDataFacade->Source->GetIn()->GetBounds().ExpandBy(Settings->ExpandBounds);
+
+		if (Settings->bClipToBounds)
+		{
+			// Sites are output as-is, with their cell information
+			SiteDataFacade = MakeShared<PCGExData::FFacade>(Context->SitesOutput->Pairs[PointDataFacade->Source->IOIndex].ToSharedRef());
+			PCGEX_INIT_IO(SiteDataFacade->Source, PCGExData::EIOInit::Duplicate)
+
+			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ClipCellsTask)
+
+			ClipCellsTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->Voronoi->EndClipped();
+					This->ActivePositions.Empty();
+					This->OutputClippedCells();
+				};
+
+			ClipCellsTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->Voronoi->ClipCells(Scope);
+				};
+
+			ClipCellsTask->StartSubLoops(Voronoi->GetNumClipSites(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+
+			return true;
+		}
+
+		ActivePositions.Empty();
 
 		if (Settings->Method == EPCGExCellCenter::Circumcenter && Settings->bPruneOutOfBounds)
 		{
@@ -203,6 +242,48 @@ namespace PCGExBuildVoronoi
 			Voronoi.Reset();
 		}
 
+		CompileGraph();
+
+		return true;
+	}
+
+	void FProcessor::OutputClippedCells()
+	{
+		const PCGExGeo::FVoronoiClippedCells& ClippedCells = Voronoi->ClippedCells;
+		const int32 NumVertices = ClippedCells.Vertices.Num();
+
+		UPCGBasePointData* CellPoints = PointDataFacade->GetOut();
+		(void)PCGEx::SetNumPointsAllocated(CellPoints, NumVertices, PointDataFacade->GetAllocations());
+
+		TPCGValueRange<FTransform> OutTransforms = CellPoints->GetTransformValueRange(true);
+		for (int i = 0; i < NumVertices; i++) { OutTransforms[i].SetLocation(ClippedCells.Vertices[i]); }
+
+		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
+		GraphBuilder->Graph->InsertEdges(ClippedCells.Edges, -1);
+
+		TArray<int32> NeighborCounts;
+		TArray<bool> OnBounds;
+		ClippedCells.GetSiteInfos(NeighborCounts, OnBounds);
+
+		if (Settings->bWriteCellNeighborCount)
+		{
+			const TSharedPtr<PCGExData::TBuffer<int32>> Writer = SiteDataFacade->GetWritable<int32>(Settings->CellNeighborCountAttributeName, 0, true, PCGExData::EBufferInit::New);
+			for (int i = 0; i < NeighborCounts.Num(); i++) { Writer->SetValue(i, NeighborCounts[i]); }
+		}
+
+		if (Settings->bWriteCellOnBounds)
+		{
+			const TSharedPtr<PCGExData::TBuffer<bool>> Writer = SiteDataFacade->GetWritable<bool>(Settings->CellOnBoundsAttributeName, false, true, PCGExData::EBufferInit::New);
+			for (int i = 0; i < OnBounds.Num(); i++) { Writer->SetValue(i, OnBounds[i]); }
+		}
+
+		Voronoi.Reset();
+
+		CompileGraph();
+	}
+
+	void FProcessor::CompileGraph()
+	{
 		// Update seeds
 
 		const int32 NumSites = PointDataFacade->GetOut()->GetNumPoints();
@@ -218,8 +299,6 @@ namespace PCGExBuildVoronoi
 
 		GraphBuilder->bInheritNodeData = false; // We're creating new points from scratch, we don't want the inheritance.
 		GraphBuilder->CompileAsync(AsyncManager, false);
-
-		return true;
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
@@ -229,10 +308,18 @@ namespace PCGExBuildVoronoi
 
 	void FProcessor::CompleteWork()
 	{
-		if (!GraphBuilder->bCompiledSuccessfully)
+		if (!GraphBuilder || !GraphBuilder->bCompiledSuccessfully)
 		{
 			bIsProcessorValid = false;
 			PCGEX_CLEAR_IO_VOID(PointDataFacade->Source)
+			if (SiteDataFacade) { PCGEX_CLEAR_IO_VOID(SiteDataFacade->Source) }
+			return;
+		}
+
+		if (SiteDataFacade)
+		{
+			SiteDataFacade->WriteFastest(AsyncManager);
+			SiteDataFacade->Source->Tags->Append(PointDataFacade->Source->Tags.ToSharedRef());
 		}
 	}
 
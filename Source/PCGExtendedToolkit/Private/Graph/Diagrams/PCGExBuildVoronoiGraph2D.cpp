@@ -101,6 +101,12 @@ bool FPCGExBuildVoronoiGraph2DElement::Boot(FPCGExContext* InContext) const
 	{
 		if (!Settings->bPruneOpenSites) { PCGEX_VALIDATE_NAME(Settings->OpenSiteFlag) }
 
+		if (Settings->bClipToBounds)
+		{
+			if (Settings->bWriteCellNeighborCount) { PCGEX_VALIDATE_NAME(Settings->CellNeighborCountAttributeName) }
+			if (Settings->bWriteCellOnBounds) { PCGEX_VALIDATE_NAME(Settings->CellOnBoundsAttributeName) }
+		}
+
 		Context->SitesOutput = MakeShared<PCGExData::FPointIOCollection>(Context);
 		Context->SitesOutput->OutputPin = PCGExGraph::OutputSitesLabel;
 
@@ -182,7 +188,8 @@ namespace PCGExBuildVoronoi2D
 		const FBox Bounds = PointDataFacade->GetIn()->GetBounds().ExpandBy(Settings->ExpandBounds);
 		bool bSuccess = false;
 
-		bSuccess = Voronoi->Process(ActivePositions, ProjectionDetails, Bounds, WithinBounds);
+		if (Settings->bClipToBounds) { bSuccess = Voronoi->BeginClipped(ActivePositions, ProjectionDetails, Bounds); }
+		else { bSuccess = Voronoi->Process(ActivePositions, ProjectionDetails, Bounds, WithinBounds); }
 
 		if (!bSuccess)
 		{
@@ -214,7 +221,11 @@ namespace PCGExBuildVoronoi2D
 		{
 			IsVtxValid.Init(true, DelaunaySitesNum);
 
-			for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->DelaunayHull.Contains(i); }
+			// Clipped cells are all closed
+			if (!Settings->bClipToBounds)
+			{
+				for (int i = 0; i < IsVtxValid.Num(); i++) { IsVtxValid[i] = !Voronoi->Delaunay->DelaunayHull.Contains(i); }
+			}
 
 			UpdateSitePosition = [&](const int32 SiteIndex)
 			{
@@ -234,6 +245,30 @@ namespace PCGExBuildVoronoi2D
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
 
+		if (Settings->bClipToBounds)
+		{
+			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ClipCellsTask)
+
+			ClipCellsTask->OnCompleteCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->Voronoi->EndClipped();
+					This->OutputClippedCells();
+				};
+
+			ClipCellsTask->OnSubLoopStartCallback =
+				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->Voronoi->ClipCells(Scope);
+				};
+
+			ClipCellsTask->StartSubLoops(Voronoi->GetNumClipSites(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+
+			return true;
+		}
+
 		if (Settings->Method == EPCGExCellCenter::Circumcenter && Settings->bPruneOutOfBounds)
 		{
 			int32 NumCentroids = 0;
@@ -387,6 +422,61 @@ namespace PCGExBuildVoronoi2D
 			GraphBuilder->Graph->InsertEdges(Voronoi->VoronoiEdges, -1);
 		}
 
+		CompileGraph();
+
+		return true;
+	}
+
+	void FProcessor::OutputClippedCells()
+	{
+		const PCGExGeo::FVoronoiClippedCells& ClippedCells = Voronoi->ClippedCells;
+		const int32 NumVertices = ClippedCells.Vertices.Num();
+
+		UPCGBasePointData* CellPoints = PointDataFacade->GetOut();
+		(void)PCGEx::SetNumPointsAllocated(CellPoints, NumVertices, PointDataFacade->GetAllocations());
+
+		TPCGValueRange<FTransform> OutTransforms = CellPoints->GetTransformValueRange(true);
+		TPCGValueRange<int32> OutSeeds = CellPoints->GetSeedValueRange(true);
+
+		for (int i = 0; i < NumVertices; i++)
+		{
+			OutTransforms[i].SetLocation(ClippedCells.Vertices[i]);
+			OutSeeds[i] = PCGExRandom::ComputeSpatialSeed(ClippedCells.Vertices[i]);
+		}
+
+		if (Settings->bOutputSites)
+		{
+			// Each cell vertex influences its site once; 2D faces are segments chained around the cell
+			for (const PCGExGeo::FVoronoiCell& Cell : ClippedCells.Cells)
+			{
+				for (const PCGExGeo::FVoronoiCellFace& Face : Cell.Faces) { SitesOutputDetails.AddInfluence(Cell.Site, ClippedCells.Vertices[Face.Vertices[0]]); }
+			}
+
+			TArray<int32> NeighborCounts;
+			TArray<bool> OnBounds;
+			ClippedCells.GetSiteInfos(NeighborCounts, OnBounds);
+
+			if (Settings->bWriteCellNeighborCount)
+			{
+				const TSharedPtr<PCGExData::TBuffer<int32>> Writer = SiteDataFacade->GetWritable<int32>(Settings->CellNeighborCountAttributeName, 0, true, PCGExData::EBufferInit::New);
+				for (int i = 0; i < NeighborCounts.Num(); i++) { Writer->SetValue(i, NeighborCounts[i]); }
+			}
+
+			if (Settings->bWriteCellOnBounds)
+			{
+				const TSharedPtr<PCGExData::TBuffer<bool>> Writer = SiteDataFacade->GetWritable<bool>(Settings->CellOnBoundsAttributeName, false, true, PCGExData::EBufferInit::New);
+				for (int i = 0; i < OnBounds.Num(); i++) { Writer->SetValue(i, OnBounds[i]); }
+			}
+		}
+
+		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
+		GraphBuilder->Graph->InsertEdges(ClippedCells.Edges, -1);
+
+		CompileGraph();
+	}
+
+	void FProcessor::CompileGraph()
+	{
 		Voronoi.Reset();
 
 		GraphBuilder->bInheritNodeData = false;
@@ -394,7 +484,7 @@ namespace PCGExBuildVoronoi2D
 
 		if (Settings->bOutputSites)
 		{
-			PCGEX_ASYNC_GROUP_CHKD(AsyncManager, OutputSites)
+			PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, OutputSites)
 
 			OutputSites->OnSubLoopStartCallback =
 				[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
@@ -416,10 +506,8 @@ namespace PCGExBuildVoronoi2D
 					}
 				};
 
-			OutputSites->StartSubLoops(DelaunaySitesNum, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+			OutputSites->StartSubLoops(PointDataFacade->GetNum(PCGExData::EIOSide::In), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 		}
-
-		return true;
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
@@ -429,7 +517,7 @@ namespace PCGExBuildVoronoi2D
 
 	void FProcessor::CompleteWork()
 	{
-		if (!GraphBuilder->bCompiledSuccessfully)
+		if (!GraphBuilder || !GraphBuilder->bCompiledSuccessfully)
 		{
 			bIsProcessorValid = false;
 			PCGEX_CLEAR_IO_VOID(PointDataFacade->Source)
@@ -206,7 +206,7 @@ namespace PCGExRefineEdges
 				{
 					PCGEX_ASYNC_THIS
 					if (This->Context->Refinement->WantsIndividualNodeProcessing()) { This->StartParallelLoopForNodes(); }
-					else { This->Refinement->Process(); }
+					else { This->Refinement->ProcessAsync(This->AsyncManager); }
 				};
 
 			EdgeScopeLoop->OnSubLoopStartCallback =
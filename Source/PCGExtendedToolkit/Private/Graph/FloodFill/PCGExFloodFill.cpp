@@ -26,7 +26,7 @@ namespace PCGExFloodFill
 	{
 		SeedIndex = InSeedIndex;
 
-		Visited.Add(SeedNode->Index);
+		MarkVisited(SeedNode->Index);
 		*(FillControlsHandler->InfluencesCount->GetData() + SeedNode->PointIndex) = 1;
 		FCandidate& SeedCandidate = Captured.Emplace_GetRef();
 		SeedCandidate.Link = PCGExGraph::FLink(-1, -1);
@@ -34,6 +34,9 @@ namespace PCGExFloodFill
 		SeedCandidate.CaptureIndex = 0;
 
 		Probe(SeedCandidate);
+
+		// Frontier growth reads buckets from the sorted tail right away
+		if (FillControlsHandler->bUseFrontier) { SortCandidates(); }
 	}
 
 	void FDiffusion::Probe(const FCandidate& From)
@@ -44,63 +47,42 @@ namespace PCGExFloodFill
 			return;
 		}
 
-		// Gather all neighbors and compute heuristics, add to candidate for the first time only
-		bool bIsAlreadyInSet = false;
-
-		TSharedPtr<PCGExHeuristics::FHeuristicsHandler> HeuristicsHandler = FillControlsHandler->HeuristicsHandler.Pin();
-		if (!HeuristicsHandler) { return; }
-
-		const PCGExCluster::FNode& FromNode = *From.Node;
-		const PCGExCluster::FNode& RoamingGoal = *HeuristicsHandler->GetRoamingGoal();
+		ProbeBatch.Reset();
+		GatherNeighbors(From);
+		CommitProbeBatch();
+	}
 
-		FVector FromPosition = Cluster->GetPos(FromNode);
+	void FDiffusion::GatherNeighbors(const FCandidate& From)
+	{
+		// Gather all neighbors, add to candidate for the first time only
+		const FVector FromPosition = Cluster->GetPos(From.Node);
+		const bool bSkipCaptured = FillControlsHandler->bUseFrontier;
 
-		for (const PCGExGraph::FLink& Lk : FromNode.Links)
+		for (const PCGExGraph::FLink& Lk : From.Node->Links)
 		{
-			PCGExCluster::FNode* OtherNode = Cluster->GetNode(Lk);
-			Visited.Add(OtherNode->Index, &bIsAlreadyInSet);
-
-			if (bIsAlreadyInSet) { continue; }
+			const PCGExCluster::FNode* OtherNode = Cluster->GetNode(Lk);
+			if (bSkipCaptured && FillControlsHandler->IsCaptured(OtherNode->PointIndex)) { continue; }
+			if (MarkVisited(OtherNode->Index)) { continue; }
 
-			FVector OtherPosition = Cluster->GetPos(OtherNode);
-			double Dist = FVector::Dist(FromPosition, OtherPosition);
-
-			const double LocalScore = HeuristicsHandler->GetEdgeScore(
-				FromNode, *OtherNode,
-				*Cluster->GetEdge(Lk), *SeedNode, RoamingGoal,
-				nullptr, TravelStack);
-
-			FCandidate Candidate = FCandidate{};
+			FCandidate& Candidate = ProbeBatch.Emplace_GetRef();
 			Candidate.CaptureIndex = From.CaptureIndex;
-
-			Candidate.Link = PCGExGraph::FLink(FromNode.Index, Lk.Edge);
+			Candidate.Link = PCGExGraph::FLink(From.Node->Index, Lk.Edge);
 			Candidate.Node = OtherNode;
-
-			if (FillControlsHandler->bUseLocalScore || FillControlsHandler->bUsePreviousScore)
-			{
-				if (FillControlsHandler->bUsePreviousScore)
-				{
-					Candidate.PathScore = From.PathScore + LocalScore;
-					Candidate.Score += From.PathScore;
-				}
-
-				if (FillControlsHandler->bUseLocalScore)
-				{
-					Candidate.Score += LocalScore;
-				}
-			}
-
-			if (FillControlsHandler->bUseGlobalScore) { Candidate.Score += HeuristicsHandler->GetGlobalScore(FromNode, *SeedNode, *OtherNode); }
-
 			Candidate.Depth = From.Depth + 1;
-			Candidate.Distance = Dist;
-			Candidate.PathDistance = From.PathDistance + Dist;
+			Candidate.Distance = FVector::Dist(FromPosition, Cluster->GetPos(OtherNode));
+			Candidate.PathDistance = From.PathDistance + Candidate.Distance;
+		}
+	}
 
-			if (FillControlsHandler->IsValidCandidate(this, From, Candidate))
-			{
-				// Valid candidate
-				Candidates.Add(Candidate);
-			}
+	void FDiffusion::CommitProbeBatch()
+	{
+		ScoreCandidates(ProbeBatch);
+
+		Candidates.Reserve(Candidates.Num() + ProbeBatch.Num());
+		for (const FCandidate& Candidate : ProbeBatch)
+		{
+			// Valid candidate
+			if (FillControlsHandler->IsValidCandidate(this, Captured[Candidate.CaptureIndex], Candidate)) { Candidates.Add(Candidate); }
 		}
 	}
 
@@ -147,6 +129,107 @@ namespace PCGExFloodFill
 
 		// Sort candidates
 
+		SortCandidates();
+	}
+
+	void FDiffusion::ClaimFrontier()
+	{
+		Frontier.Reset();
+
+		if (bStopped) { return; }
+
+		if (Candidates.IsEmpty())
+		{
+			bStopped = true;
+			return;
+		}
+
+		// Candidates are sorted so the best ones sit at the end of the array;
+		// claim everything that falls into the same priority bucket as the best one.
+		// Captures are only written during the next pass, so the captured state read here is stable.
+
+		const double Bucket = FMath::Floor(GetPriority(Candidates.Last()) / FillControlsHandler->FrontierBucketWidth);
+
+		while (!Candidates.IsEmpty())
+		{
+			if (FMath::Floor(GetPriority(Candidates.Last()) / FillControlsHandler->FrontierBucketWidth) != Bucket) { break; }
+
+			FCandidate Candidate = Candidates.Pop(EAllowShrinking::No);
+
+			if (FillControlsHandler->IsCaptured(Candidate.Node->PointIndex)) { continue; }
+			if (!FillControlsHandler->IsValidCapture(this, Candidate)) { continue; }
+
+			FillControlsHandler->Claim(Candidate.Node->Index, GetClaimKey(Candidate));
+			Frontier.Add(Candidate);
+		}
+	}
+
+	void FDiffusion::CaptureFrontier()
+	{
+		FirstFrontierCapture = Captured.Num();
+
+		for (const FCandidate& Candidate : Frontier)
+		{
+			// Only the winning diffusion may capture a contested node, which keeps results independent from scheduling.
+			// Lost claims go back into the queue : if the winner ends up rejecting the node, it's still up for grabs next wave.
+			if (!FillControlsHandler->IsClaimedBy(Candidate.Node->Index, GetClaimKey(Candidate)))
+			{
+				Candidates.Add(Candidate);
+				continue;
+			}
+
+			if (!FillControlsHandler->TryCapture(this, Candidate)) { continue; }
+
+			MaxDepth = FMath::Max(MaxDepth, Candidate.Depth);
+			MaxDistance = FMath::Max(MaxDistance, Candidate.PathDistance);
+
+			FCandidate& CapturedCandidate = Captured.Add_GetRef(Candidate);
+			CapturedCandidate.CaptureIndex = Captured.Num() - 1;
+
+			TravelStack->Set(Candidate.Node->Index, PCGEx::NH64(Candidate.Link.Node, Candidate.Link.Edge));
+
+			Endpoints.Add(CapturedCandidate.CaptureIndex);
+			Endpoints.Remove(Candidate.CaptureIndex);
+		}
+	}
+
+	void FDiffusion::ProbeFrontier()
+	{
+		for (const FCandidate& Candidate : Frontier) { FillControlsHandler->ReleaseClaim(Candidate.Node->Index); }
+		Frontier.Reset();
+
+		if (bStopped) { return; }
+
+		// Gather the neighbors of the whole new frontier first, score them in a single pass after
+
+		ProbeBatch.Reset();
+
+		for (int32 i = FirstFrontierCapture; i < Captured.Num(); i++)
+		{
+			const FCandidate& From = Captured[i];
+			if (FillControlsHandler->IsValidProbe(this, From)) { GatherNeighbors(From); }
+		}
+
+		CommitProbeBatch();
+
+		if (Candidates.IsEmpty())
+		{
+			bStopped = true;
+			return;
+		}
+
+		SortCandidates();
+	}
+
+	bool FDiffusion::MarkVisited(const int32 NodeIndex)
+	{
+		bool bIsAlreadyInSet = false;
+		Visited.Add(NodeIndex, &bIsAlreadyInSet);
+		return bIsAlreadyInSet;
+	}
+
+	void FDiffusion::SortCandidates()
+	{
 		switch (FillControlsHandler->Sorting)
 		{
 		case EPCGExFloodFillPrioritization::Heuristics:
@@ -168,6 +251,51 @@ namespace PCGExFloodFill
 		}
 	}
 
+	double FDiffusion::GetPriority(const FCandidate& Candidate) const
+	{
+		return FillControlsHandler->Sorting == EPCGExFloodFillPrioritization::Heuristics ? Candidate.Score : Candidate.Depth;
+	}
+
+	void FDiffusion::ScoreCandidates(TArray<FCandidate>& InBatch) const
+	{
+		if (InBatch.IsEmpty()) { return; }
+
+		const TSharedPtr<PCGExHeuristics::FHeuristicsHandler> HeuristicsHandler = FillControlsHandler->HeuristicsHandler.Pin();
+		if (!HeuristicsHandler) { return; }
+
+		const PCGExCluster::FNode& RoamingGoal = *HeuristicsHandler->GetRoamingGoal();
+
+		const bool bUseLocalScore = FillControlsHandler->bUseLocalScore;
+		const bool bUsePreviousScore = FillControlsHandler->bUsePreviousScore;
+		const bool bUseGlobalScore = FillControlsHandler->bUseGlobalScore;
+
+		if (bUseLocalScore || bUsePreviousScore)
+		{
+			for (FCandidate& Candidate : InBatch)
+			{
+				const FCandidate& From = Captured[Candidate.CaptureIndex];
+
+				const double LocalScore = HeuristicsHandler->GetEdgeScore(
+					*From.Node, *Candidate.Node,
+					*Cluster->GetEdge(Candidate.Link.Edge), *SeedNode, RoamingGoal,
+					nullptr, TravelStack);
+
+				if (bUsePreviousScore)
+				{
+					Candidate.PathScore = From.PathScore + LocalScore;
+					Candidate.Score += From.PathScore;
+				}
+
+				if (bUseLocalScore) { Candidate.Score += LocalScore; }
+			}
+		}
+
+		if (bUseGlobalScore)
+		{
+			for (FCandidate& Candidate : InBatch) { Candidate.Score += HeuristicsHandler->GetGlobalScore(*Captured[Candidate.CaptureIndex].Node, *SeedNode, *Candidate.Node); }
+		}
+	}
+
 	void FDiffusion::Diffuse(
 		const TSharedPtr<PCGExData::FFacade>& InVtxFacade,
 		const TSharedPtr<PCGExDataBlending::FBlendOpsManager>& InBlendOps,
@@ -263,9 +391,35 @@ namespace PCGExFloodFill
 		return true;
 	}
 
-	bool FFillControlsHandler::TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
+	void FFillControlsHandler::EnableFrontier(const double InBucketWidth)
+	{
+		FrontierBucketWidth = FMath::Max(InBucketWidth, UE_SMALL_NUMBER);
+		bUseFrontier = true;
+		FrontierClaims.Init(MAX_int64, Cluster->Nodes->Num());
+	}
+
+	void FFillControlsHandler::Claim(const int32 NodeIndex, const int64 Key)
+	{
+		// Atomic min, so the outcome doesn't depend on which diffusion claims first
+		int64* Slot = FrontierClaims.GetData() + NodeIndex;
+		int64 Current = FPlatformAtomics::AtomicRead(Slot);
+		while (Key < Current)
+		{
+			const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(Slot, Key, Current);
+			if (Previous == Current) { return; }
+			Current = Previous;
+		}
+	}
+
+	bool FFillControlsHandler::IsValidCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
 	{
 		for (const TSharedPtr<FPCGExFillControlOperation>& Op : SubOpsCapture) { if (!Op->IsValidCapture(Diffusion, Candidate)) { return false; } }
+		return true;
+	}
+
+	bool FFillControlsHandler::TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
+	{
+		if (!IsValidCapture(Diffusion, Candidate)) { return false; }
 		if (FPlatformAtomics::InterlockedCompareExchange((InfluencesCount->GetData() + Candidate.Node->PointIndex), 1, 0) == 1) { return false; }
 		return true;
 	}
@@ -224,6 +224,8 @@ namespace PCGExClusterDiffusion
 			return;
 		}
 
+		if (Settings->Processing == EPCGExFloodFillProcessing::Frontier) { FillControlsHandler->EnableFrontier(Settings->FrontierBucketWidth); }
+
 		for (int i = 0; i < OngoingDiffusions.Num(); i++)
 		{
 			TSharedPtr<PCGExFloodFill::FDiffusion> Diffusion = OngoingDiffusions[i];
@@ -234,7 +236,7 @@ namespace PCGExClusterDiffusion
 
 		Diffusions.Reserve(OngoingDiffusions.Num());
 
-		if (Settings->Processing == EPCGExFloodFillProcessing::Parallel)
+		if (Settings->Processing != EPCGExFloodFillProcessing::Sequence)
 		{
 			Grow();
 		}
@@ -256,8 +258,18 @@ namespace PCGExClusterDiffusion
 	{
 		if (OngoingDiffusions.IsEmpty()) { return; }
 
-		if (Settings->Processing == EPCGExFloodFillProcessing::Parallel)
+		if (Settings->Processing != EPCGExFloodFillProcessing::Sequence)
 		{
+			if (Settings->Processing == EPCGExFloodFillProcessing::Frontier)
+			{
+				// Diffusions advance in lockstep waves; each one takes part in as many waves as its fill rate
+				NumFrontierWaves = 0;
+				for (const TSharedPtr<PCGExFloodFill::FDiffusion>& Diffusion : OngoingDiffusions)
+				{
+					NumFrontierWaves = FMath::Max(NumFrontierWaves, FillRate->Read(Diffusion->GetSettingsIndex(Settings->Diffusion.FillRateSource)));
+				}
+			}
+
 			// Grow all by a single step
 			StartParallelLoopForRange(OngoingDiffusions.Num());
 			return;
@@ -278,12 +290,41 @@ namespace PCGExClusterDiffusion
 		{
 			const TSharedPtr<PCGExFloodFill::FDiffusion> Diffusion = OngoingDiffusions[Index];
 			const int32 CurrentFillRate = FillRate->Read(Diffusion->GetSettingsIndex(Settings->Diffusion.FillRateSource));
-			for (int i = 0; i < CurrentFillRate; i++) { Diffusion->Grow(); }
+
+			if (Settings->Processing == EPCGExFloodFillProcessing::Frontier)
+			{
+				if (FrontierWave >= CurrentFillRate) { continue; }
+
+				if (FrontierPass == 0) { Diffusion->ClaimFrontier(); }
+				else if (FrontierPass == 1) { Diffusion->CaptureFrontier(); }
+				else { Diffusion->ProbeFrontier(); }
+			}
+			else { for (int i = 0; i < CurrentFillRate; i++) { Diffusion->Grow(); } }
 		}
 	}
 
 	void FProcessor::OnRangeProcessingComplete()
 	{
+		if (Settings->Processing == EPCGExFloodFillProcessing::Frontier)
+		{
+			// Each frontier pass must be complete for every diffusion before the next one starts
+			if (++FrontierPass < 3)
+			{
+				StartParallelLoopForRange(OngoingDiffusions.Num());
+				return;
+			}
+
+			FrontierPass = 0;
+
+			if (++FrontierWave < NumFrontierWaves)
+			{
+				StartParallelLoopForRange(OngoingDiffusions.Num());
+				return;
+			}
+
+			FrontierWave = 0;
+		}
+
 		// A single growth iteration pass is complete
 		const int32 OngoingNum = OngoingDiffusions.Num();
 
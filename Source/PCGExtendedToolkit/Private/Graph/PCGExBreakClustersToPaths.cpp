@@ -145,17 +145,16 @@ namespace PCGExBreakClustersToPaths
 	{
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const TSharedPtr<PCGExCluster::FNodeChain> Chain = ChainBuilder->Chains[Index];
-			if (!Chain) { continue; }
+			const PCGExCluster::FNodeChain& Chain = ChainBuilder->Chains[Index];
 
-			if (Settings->LeavesHandling == EPCGExBreakClusterLeavesHandling::Exclude && Chain->bIsLeaf) { continue; }
+			if (Settings->LeavesHandling == EPCGExBreakClusterLeavesHandling::Exclude && Chain.bIsLeaf) { continue; }
 
-			const int32 ChainSize = Chain->Links.Num() + 1;
+			const int32 ChainSize = Chain.Links.Num() + 1;
 
 			if (ChainSize < Settings->MinPointCount) { continue; }
 			if (Settings->bOmitAbovePointCount && ChainSize > Settings->MaxPointCount) { continue; }
 
-			const bool bReverse = DirectionSettings.SortExtrapolation(Cluster.Get(), Chain->Seed.Edge, Chain->Seed.Node, Chain->Links.Last().Node);
+			const bool bReverse = DirectionSettings.SortExtrapolation(Cluster.Get(), Chain.Seed.Edge, Chain.Seed.Node, Chain.Links.Last().Node);
 
 			const TSharedPtr<PCGExData::FPointIO> PathIO = Context->Paths->Emplace_GetRef<UPCGPointArrayData>(VtxDataFacade->Source, PCGExData::EIOInit::New);
 			if (!PathIO) { continue; }
@@ -164,19 +163,19 @@ namespace PCGExBreakClustersToPaths
 			(void)PCGEx::SetNumPointsAllocated(PathIO->GetOut(), ChainSize, PathIO->GetOut()->GetAllocatedProperties());
 
 			TArray<int32>& IdxMapping = PathIO->GetIdxMapping();
-			IdxMapping[0] = Cluster->GetNodePointIndex(Chain->Seed);
+			IdxMapping[0] = Cluster->GetNodePointIndex(Chain.Seed);
 
-			if (ProjectedVtxPositions && (!Settings->bWindOnlyClosedLoops || Chain->bIsClosedLoop))
+			if (ProjectedVtxPositions && (!Settings->bWindOnlyClosedLoops || Chain.bIsClosedLoop))
 			{
 				const TArray<FVector2D>& PP = *ProjectedVtxPositions.Get();
 				TArray<FVector2D> ProjectedPoints;
 				ProjectedPoints.SetNumUninitialized(ChainSize);
 
-				ProjectedPoints[0] = PP[Cluster->GetNodePointIndex(Chain->Seed)];
+				ProjectedPoints[0] = PP[Cluster->GetNodePointIndex(Chain.Seed)];
 
 				for (int i = 1; i < ChainSize; i++)
 				{
-					const int32 PtIndex = Cluster->GetNodePointIndex(Chain->Links[i - 1]);
+					const int32 PtIndex = Cluster->GetNodePointIndex(Chain.Links[i - 1]);
 					IdxMapping[i] = PtIndex;
 					ProjectedPoints[i] = PP[PtIndex];
 				}
@@ -188,12 +187,12 @@ namespace PCGExBreakClustersToPaths
 			}
 			else
 			{
-				for (int i = 1; i < ChainSize; i++) { IdxMapping[i] = Cluster->GetNodePointIndex(Chain->Links[i - 1]); }
+				for (int i = 1; i < ChainSize; i++) { IdxMapping[i] = Cluster->GetNodePointIndex(Chain.Links[i - 1]); }
 			}
 
 			if (bDoReverse) { Algo::Reverse(IdxMapping); }
 
-			PCGExPaths::SetClosedLoop(PathIO->GetOut(), Chain->bIsClosedLoop);
+			PCGExPaths::SetClosedLoop(PathIO->GetOut(), Chain.bIsClosedLoop);
 
 			PathIO->ConsumeIdxMapping(EPCGPointNativeProperties::All);
 		}
@@ -6,69 +6,6 @@
 
 namespace PCGExCluster
 {
-	void FNodeChain::FixUniqueHash()
-	{
-		UniqueHash = 0;
-
-		if (Links.Num() <= 1)
-		{
-			SingleEdge = Seed.Edge;
-			UniqueHash = SingleEdge;
-			return;
-		}
-
-		const FLink LastLink = Links.Last();
-		UniqueHash = PCGEx::H64U(HashCombineFast(Seed.Node, Seed.Edge), HashCombineFast(LastLink.Node, LastLink.Edge));
-	}
-
-	void FNodeChain::BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints)
-	{
-		ON_SCOPE_EXIT
-		{
-			bIsLeaf = Cluster->GetNode(Seed.Node)->IsLeaf() || Cluster->GetNode(Links.Last().Node)->IsLeaf();
-			if (bIsClosedLoop) { bIsLeaf = false; }
-			FixUniqueHash();
-		};
-
-		TSet<int32> Visited;
-
-		FLink Last = Seed;
-		FNode* FromNode = Cluster->GetEdgeOtherNode(Seed);
-		Links.Add(FLink(FromNode->Index, Seed.Edge));
-
-		Visited.Add(Seed.Node);
-		Visited.Add(Links.Last().Node);
-
-		while (FromNode)
-		{
-			if (FromNode->IsLeaf() ||
-				FromNode->IsComplex() ||
-				(Breakpoints && (*Breakpoints)[FromNode->PointIndex]))
-			{
-				bIsClosedLoop = false;
-				break;
-			}
-
-			FLink NextLink = FromNode->Links[0];                               // Get next node
-			if (NextLink.Node == Last.Node) { NextLink = FromNode->Links[1]; } // Get other next
-
-			bool bAlreadyVisited = false;
-			Visited.Add(NextLink.Node, &bAlreadyVisited);
-
-			if (bAlreadyVisited || NextLink.Node == Seed.Node)
-			{
-				Seed.Edge = NextLink.Edge; // !
-				bIsClosedLoop = true;
-				break;
-			}
-
-			Last = Links.Last();
-			Links.Add(NextLink);
-
-			FromNode = Cluster->GetNode(NextLink.Node);
-		}
-	}
-
 	void FNodeChain::Dump(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const
 	{
 		const int32 IOIndex = Cluster->EdgesIO.Pin()->IOIndex;
@@ -168,7 +105,7 @@ namespace PCGExCluster
 		return GetLastEdgeDir(Cluster);
 	}
 
-	int32 FNodeChain::GetNodes(const TSharedPtr<FCluster>& Cluster, TArray<int32>& OutNodes, const bool bReverse)
+	int32 FNodeChain::GetNodes(const TSharedPtr<FCluster>& Cluster, TArray<int32>& OutNodes, const bool bReverse) const
 	{
 		if (SingleEdge != -1)
 		{
@@ -209,7 +146,8 @@ namespace PCGExCluster
 
 	bool FNodeChainBuilder::Compile(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		Chains.Reserve(Cluster->Edges->Num());
+		bLeavesOnly = false;
+		Seeds.Reserve(Cluster->Edges->Num());
 		int32 NumBinaries = 0;
 
 		for (int i = 0; i < Cluster->Nodes->Num(); i++)
@@ -220,8 +158,7 @@ namespace PCGExCluster
 			if (Node->IsEmpty()) { continue; }
 			if (Node->IsLeaf())
 			{
-				PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
-				Chains.Add(NewChain);
+				Seeds.Add(FLink(Node->Index, Node->Links[0].Edge));
 				continue;
 			}
 
@@ -238,32 +175,30 @@ namespace PCGExCluster
 			{
 				// Skip immediately known leaves or already seeded nodes. Avoid double-sampling simple cases
 				if (Cluster->GetNode(Lk.Node)->IsLeaf()) { continue; }
-
-				PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Lk.Edge))
-				Chains.Add(NewChain);
+				Seeds.Add(FLink(Node->Index, Lk.Edge));
 			}
 		}
 
-		Chains.Shrink();
-		if (Chains.IsEmpty())
+		if (Seeds.IsEmpty())
 		{
 			if (NumBinaries > 0 && NumBinaries == Cluster->Nodes->Num())
 			{
 				// That's an isolated closed loop
-				PCGEX_MAKE_SHARED(NewChain, FNodeChain, Cluster->GetNode(0)->Links[0])
-				Chains.Add(NewChain);
+				Seeds.Add(Cluster->GetNode(0)->Links[0]);
 			}
 			else
 			{
 				return false;
 			}
 		}
+
 		return DispatchTasks(AsyncManager);
 	}
 
 	bool FNodeChainBuilder::CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
 	{
-		Chains.Reserve(Cluster->Edges->Num());
+		bLeavesOnly = true;
+		Seeds.Reserve(Cluster->Edges->Num());
 
 		for (int i = 0; i < Cluster->Nodes->Num(); i++)
 		{
@@ -271,12 +206,10 @@ namespace PCGExCluster
 			ensure(!Node->IsEmpty());
 			if (!Node->IsLeaf() || Node->IsEmpty()) { continue; }
 
-			PCGEX_MAKE_SHARED(NewChain, FNodeChain, FLink(Node->Index, Node->Links[0].Edge))
-			Chains.Add(NewChain);
+			Seeds.Add(FLink(Node->Index, Node->Links[0].Edge));
 		}
 
-		Chains.Shrink();
-		if (Chains.IsEmpty()) { return false; }
+		if (Seeds.IsEmpty()) { return false; }
 		return DispatchTasks(AsyncManager);
 	}
 
@@ -288,34 +221,129 @@ namespace PCGExCluster
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
-				This->Dedupe();
+				This->CompactChains();
+			};
+
+		ChainSearchTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopedChains.SetNum(Loops.Num());
 			};
 
-		ChainSearchTask->OnIterationCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]
-			(const int32 Index, const PCGExMT::FScope& Scope)
+		ChainSearchTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Chains[Index]->BuildChain(This->Cluster, This->Breakpoints);
+				This->BuildChains(Scope);
 			};
 
-		ChainSearchTask->StartIterations(Chains.Num(), 64, false);
+		ChainSearchTask->StartSubLoops(Seeds.Num(), 64, false);
 		return true;
 	}
 
-	void FNodeChainBuilder::Dedupe()
+	void FNodeChainBuilder::BuildChains(const PCGExMT::FScope& Scope)
 	{
-		TSet<uint64> UniqueHashSet;
-		UniqueHashSet.Reserve(Chains.Num());
+		FScopedChains& Scoped = ScopedChains[Scope.LoopIndex];
+		Scoped.Chains.Reserve(Scope.Count);
+		Scoped.NumLinks.Reserve(Scope.Count);
 
-		for (int i = 0; i < Chains.Num(); i++)
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			const TSharedPtr<FNodeChain>& Chain = Chains[i];
+			const FLink Seed = Seeds[Index];
+			const FNode* SeedNode = Cluster->GetNode(Seed.Node);
 
-			bool bAlreadySet = false;
-			UniqueHashSet.Add(Chain->UniqueHash, &bAlreadySet);
+			const int32 Start = Scoped.Links.Num();
+
+			FLink Current = FLink(Cluster->GetEdgeOtherNode(Seed)->Index, Seed.Edge);
+			Scoped.Links.Add(Current);
+
+			int32 ClosingEdge = -1;
+
+			// Walk binary nodes until a breaking one. A binary run can only ever loop back to its seed.
+			while (true)
+			{
+				const FNode* FromNode = Cluster->GetNode(Current.Node);
+				if (IsBreaking(FromNode)) { break; }
 
-			if (bAlreadySet) { Chains[i] = nullptr; }
+				FLink Next = FromNode->Links[0];
+				if (Next.Edge == Current.Edge) { Next = FromNode->Links[1]; }
+
+				if (Next.Node == Seed.Node)
+				{
+					ClosingEdge = Next.Edge;
+					break;
+				}
+
+				Scoped.Links.Add(Next);
+				Current = Next;
+			}
+
+			const int32 NumLinks = Scoped.Links.Num() - Start;
+			const FNode* EndNode = Cluster->GetNode(Current.Node);
+			const bool bIsClosedLoop = ClosingEdge != -1;
+
+			// A chain is seeded from each of its breaking ends, and owned by the lower-index one.
+			// Non-leaf nodes don't seed towards adjacent leaves, and only leaves seed in leaves-only mode.
+			bool bOwned = true;
+			if (bIsClosedLoop)
+			{
+				if (IsBreaking(SeedNode)) { bOwned = Seed.Edge < ClosingEdge; }
+			}
+			else if (EndNode->IsLeaf() || (!bLeavesOnly && !(NumLinks == 1 && SeedNode->IsLeaf())))
+			{
+				bOwned = Seed.Node < EndNode->Index;
+			}
+
+			if (!bOwned)
+			{
+				Scoped.Links.SetNum(Start, EAllowShrinking::No);
+				continue;
+			}
+
+			FNodeChain& Chain = Scoped.Chains.Emplace_GetRef(bIsClosedLoop ? FLink(Seed.Node, ClosingEdge) : Seed);
+			Chain.bIsClosedLoop = bIsClosedLoop;
+			Chain.bIsLeaf = !bIsClosedLoop && (SeedNode->IsLeaf() || EndNode->IsLeaf());
+			if (NumLinks <= 1) { Chain.SingleEdge = Seed.Edge; }
+
+			Scoped.NumLinks.Add(NumLinks);
 		}
 	}
+
+	void FNodeChainBuilder::CompactChains()
+	{
+		int32 NumChains = 0;
+		int32 NumLinks = 0;
+
+		for (const FScopedChains& Scoped : ScopedChains)
+		{
+			NumChains += Scoped.Chains.Num();
+			NumLinks += Scoped.Links.Num();
+		}
+
+		Chains.Reserve(NumChains);
+		ChainLinks.Reserve(NumLinks);
+
+		for (FScopedChains& Scoped : ScopedChains)
+		{
+			Chains.Append(Scoped.Chains);
+			ChainLinks.Append(Scoped.Links);
+		}
+
+		// Storage is final, chains can now point into it
+		int32 ChainIndex = 0;
+		int32 Offset = 0;
+
+		for (const FScopedChains& Scoped : ScopedChains)
+		{
+			for (const int32 Count : Scoped.NumLinks)
+			{
+				Chains[ChainIndex++].Links = TConstArrayView<FLink>(ChainLinks.GetData() + Offset, Count);
+				Offset += Count;
+			}
+		}
+
+		ScopedChains.Empty();
+		Seeds.Empty();
+	}
 }
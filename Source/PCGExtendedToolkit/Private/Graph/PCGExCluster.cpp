@@ -129,8 +129,13 @@ namespace PCGExCluster
 		{
 			Nodes = OriginalCluster->Nodes;
 
-			// Update index lookup
-			for (const FNode& Node : *Nodes) { NodeIndexLookup->GetMutable(Node.PointIndex) = Node.Index; }
+			// Update index lookup, unless it's the very one the original cluster already filled
+			if (NodeIndexLookup != OriginalCluster->NodeIndexLookup)
+			{
+				for (const FNode& Node : *Nodes) { NodeIndexLookup->GetMutable(Node.PointIndex) = Node.Index; }
+			}
+
+			NodeOctree = OriginalCluster->NodeOctree;
 		}
 
 		if (bCopyEdges)
@@ -156,9 +161,30 @@ namespace PCGExCluster
 		else
 		{
 			Edges = OriginalCluster->Edges;
+			EdgeOctree = OriginalCluster->EdgeOctree;
 		}
 	}
 
+	TSharedRef<FCluster> FCluster::MakeInstance(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::MakeInstance);
+
+		TSharedRef<FCluster> Instance = MakeShared<FCluster>(SharedThis(this), InVtxIO, InEdgesIO, NodeIndexLookup, false, false, false);
+		Instance->WillModifyVtxPositions();
+
+		// Instances are bound to the transformed copy, not to its source
+		Instance->VtxPoints = InVtxIO->GetOut();
+		Instance->VtxTransforms = Instance->VtxPoints->GetConstTransformValueRange();
+
+		Instance->Bounds = FBox(ForceInit);
+		for (const FNode& Node : *Nodes) { Instance->Bounds += Instance->VtxTransforms[Node.PointIndex].GetLocation(); }
+		Instance->Bounds = Instance->Bounds.ExpandBy(10);
+
+		// Octrees were reset along with positions, they are rebuilt on demand
+
+		return Instance;
+	}
+
 	void FCluster::TConstVtxLookup::Dump(TArray<int32>& OutIndices) const
 	{
 		const int32 NumNodes = Num();
@@ -74,6 +74,18 @@ namespace PCGExClusterMT
 			Cluster = HandleCachedCluster(CachedCluster.ToSharedRef());
 		}
 
+		uint64 PersistentKey = 0;
+		if (!Cluster && GetDefault<UPCGExGlobalSettings>()->WantsPersistentClusterCache(EdgeDataFacade->GetNum()))
+		{
+			PersistentKey = PCGExClusterData::ComputePersistentKey(VtxDataFacade->Source, EdgeDataFacade->Source);
+			Cluster = PCGExClusterData::TryLoadPersistentCluster(PersistentKey, VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
+			if (Cluster)
+			{
+				Cluster->bIsOneToOne = bIsOneToOne;
+				PersistentKey = 0; // Already on disk
+			}
+		}
+
 		if (!Cluster)
 		{
 			Cluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
@@ -85,6 +97,8 @@ namespace PCGExClusterMT
 				Cluster.Reset();
 				return false;
 			}
+
+			if (PersistentKey) { PCGExClusterData::SavePersistentCluster(PersistentKey, Cluster.ToSharedRef()); }
 		}
 
 		if (ProjectedVtxPositions)
@@ -99,6 +99,9 @@ namespace PCGExCopyClusters
 
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
 	{
+		// Build (or fetch) the cluster once so every copy can be bound to a cheap instance of it
+		bBuildCluster = GetDefault<UPCGExGlobalSettings>()->bCacheClusters;
+
 		if (!IProcessor::Process(InAsyncManager)) { return false; }
 
 		const int32 NumTargets = Context->TargetsDataFacade->GetNum();
@@ -181,9 +184,6 @@ namespace PCGExCopyClusters
 		const UPCGBasePointData* InTargetsData = Context->TargetsDataFacade->GetIn();
 		const int32 NumTargets = InTargetsData->GetNumPoints();
 
-		// Once work is complete, check if there are cached clusters we can forward
-		const TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
-
 		for (int i = 0; i < NumTargets; i++)
 		{
 			TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
@@ -194,24 +194,28 @@ namespace PCGExCopyClusters
 			Context->TargetsForwardHandler->Forward(i, EdgeDupe->GetOut()->Metadata);
 		}
 
-		if (!CachedCluster) { return; }
-
-		for (int i = 0; i < NumTargets; i++)
-		{
-			TSharedPtr<PCGExData::FPointIO> VtxDupe = *(VtxDupes->GetData() + i);
-			TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
+		if (!Cluster) { return; }
 
-			if (!EdgeDupe) { continue; }
+		// Copies are transformed by now; forward an instance of the cluster so downstream nodes don't rebuild it
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, BindInstancesTask)
 
-			UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
-			if (CachedCluster && EdgeDupeTypedData)
+		BindInstancesTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
 			{
-				EdgeDupeTypedData->SetBoundCluster(
-					MakeShared<PCGExCluster::FCluster>(
-						CachedCluster.ToSharedRef(), VtxDupe, EdgeDupe, CachedCluster->NodeIndexLookup,
-						false, false, false));
-			}
-		}
+				PCGEX_ASYNC_THIS
+
+				TSharedPtr<PCGExData::FPointIO> VtxDupe = *(This->VtxDupes->GetData() + Index);
+				TSharedPtr<PCGExData::FPointIO> EdgeDupe = This->EdgesDupes[Index];
+
+				if (!EdgeDupe) { return; }
+
+				if (UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut()))
+				{
+					EdgeDupeTypedData->SetBoundCluster(This->Cluster->MakeInstance(VtxDupe, EdgeDupe));
+				}
+			};
+
+		BindInstancesTask->StartIterations(NumTargets, 1);
 	}
 
 	FBatch::~FBatch()
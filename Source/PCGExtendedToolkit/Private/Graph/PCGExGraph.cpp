@@ -98,15 +98,20 @@ bool FPCGExGraphBuilderDetails::WantsClusters() const
 }
 
 bool FPCGExGraphBuilderDetails::IsValid(const TSharedPtr<PCGExGraph::FSubGraph>& InSubgraph) const
+{
+	return IsValid(InSubgraph->Nodes.Num(), InSubgraph->Edges.Num());
+}
+
+bool FPCGExGraphBuilderDetails::IsValid(const int32 NumVtx, const int32 NumEdges) const
 {
 	if (bRemoveBigClusters)
 	{
-		if (InSubgraph->Edges.Num() > MaxEdgeCount || InSubgraph->Nodes.Num() > MaxVtxCount) { return false; }
+		if (NumEdges > MaxEdgeCount || NumVtx > MaxVtxCount) { return false; }
 	}
 
 	if (bRemoveSmallClusters)
 	{
-		if (InSubgraph->Edges.Num() < MinEdgeCount || InSubgraph->Nodes.Num() < MinVtxCount) { return false; }
+		if (NumEdges < MinEdgeCount || NumVtx < MinVtxCount) { return false; }
 	}
 
 	return true;
@@ -1387,8 +1392,9 @@ namespace PCGExGraphTask
 		PCGExData::DataIDType OutId;
 		PCGExGraph::SetClusterVtx(VtxDupe, OutId);
 
+		// Vtx are transformed inline, cluster instances below need their final positions
 		PCGEX_MAKE_SHARED(VtxTask, PCGExGeoTasks::FTransformPointIO, TaskIndex, PointIO, VtxDupe, TransformDetails);
-		Launch(VtxTask);
+		VtxTask->ExecuteTask(AsyncManager);
 
 		for (const TSharedPtr<PCGExData::FPointIO>& Edges : GraphBuilder->EdgesIO->Pairs)
 		{
@@ -1400,8 +1406,18 @@ namespace PCGExGraphTask
 
 			PCGEX_MAKE_SHARED(EdgeTask, PCGExGeoTasks::FTransformPointIO, TaskIndex, PointIO, EdgeDupe, TransformDetails);
 			Launch(EdgeTask);
-		}
 
-		// TODO : Copy & Transform cluster as well for a big perf boost
+			// Share the cluster built for the source graph instead of letting each copy rebuild it downstream
+			const UPCGExClusterEdgesData* SourceEdgesData = Cast<UPCGExClusterEdgesData>(Edges->GetOut());
+			if (!SourceEdgesData) { continue; }
+
+			const TSharedPtr<PCGExCluster::FCluster>& SourceCluster = SourceEdgesData->GetBoundCluster();
+			if (!SourceCluster) { continue; }
+
+			if (UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut()))
+			{
+				EdgeDupeTypedData->SetBoundCluster(SourceCluster->MakeInstance(VtxDupe, EdgeDupe));
+			}
+		}
 	}
 }
@@ -221,27 +221,8 @@ bool FPCGExMeshToClustersElement::ExecuteInternal(
 
 namespace PCGExMeshToCluster
 {
-	void FExtractMeshAndBuildGraph::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	static void BuildMeshGraph(FPCGExMeshToClustersContext* Context, const int32 TaskIndex, const TSharedPtr<PCGExGeo::FGeoStaticMesh>& Mesh)
 	{
-		FPCGExMeshToClustersContext* Context = AsyncManager->GetContext<FPCGExMeshToClustersContext>();
-		PCGEX_SETTINGS(MeshToClusters)
-
-		switch (Mesh->DesiredTriangulationType)
-		{
-		default: ;
-		case EPCGExTriangulationType::Raw:
-			Mesh->ExtractMeshSynchronous();
-			break;
-		case EPCGExTriangulationType::Dual:
-			Mesh->TriangulateMeshSynchronous();
-			Mesh->MakeDual();
-			break;
-		case EPCGExTriangulationType::Hollow:
-			Mesh->TriangulateMeshSynchronous();
-			Mesh->MakeHollowDual();
-			break;
-		}
-
 		const TSharedPtr<PCGExData::FPointIO> RootVtx = Context->RootVtx->Emplace_GetRef<UPCGExClusterNodesData>();
 		if (!RootVtx) { return; }
 
@@ -272,6 +253,28 @@ namespace PCGExMeshToCluster
 		GraphBuilder->Graph->InsertEdges(Mesh->Edges, -1);
 		GraphBuilder->CompileAsync(Context->GetAsyncManager(), true);
 	}
+
+	void FExtractMeshAndBuildGraph::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	{
+		FPCGExMeshToClustersContext* Context = AsyncManager->GetContext<FPCGExMeshToClustersContext>();
+
+		// Welding, edges & dual extraction run as task groups, the graph is built once the mesh is loaded
+		TWeakPtr<FPCGContextHandle> WeakHandle = Context->GetOrCreateHandle();
+		TWeakPtr<PCGExGeo::FGeoStaticMesh> WeakMesh = Mesh;
+		const int32 MeshIndex = TaskIndex;
+
+		Mesh->ExtractMeshAsync(
+			AsyncManager,
+			[WeakHandle, WeakMesh, MeshIndex]()
+			{
+				PCGEX_SHARED_TCONTEXT_VOID(MeshToClusters, WeakHandle)
+
+				const TSharedPtr<PCGExGeo::FGeoStaticMesh> LoadedMesh = WeakMesh.Pin();
+				if (!LoadedMesh) { return; }
+
+				BuildMeshGraph(SharedContext.Get(), MeshIndex, LoadedMesh);
+			});
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
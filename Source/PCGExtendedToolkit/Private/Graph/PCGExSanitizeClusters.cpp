@@ -3,6 +3,9 @@
 
 #include "Graph/PCGExSanitizeClusters.h"
 
+#include "PCGExRandom.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
 
 #define LOCTEXT_NAMESPACE "PCGExGraphSettings"
 
@@ -64,23 +67,388 @@ namespace PCGExSanitizeClusters
 
 		if (!IProcessor::Process(InAsyncManager)) { return false; }
 
-		TArray<PCGExGraph::FEdge> IndexedEdges;
-
 		BuildIndexedEdges(EdgeDataFacade->Source, *EndpointsLookup, IndexedEdges);
-		if (!IndexedEdges.IsEmpty()) { GraphBuilder->Graph->InsertEdges(IndexedEdges); }
-
 		EdgeDataFacade->Source->ClearCachedKeys();
 
+		// Edges are only inserted into the graph builder if the batch turns out to need a rebuild
+		return StartIntegrityCheck();
+	}
+
+	bool FProcessor::StartIntegrityCheck()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSanitizeClusters::StartIntegrityCheck);
+
+		const int32 NumEdges = IndexedEdges.Num();
+
+		// Some endpoints could not be resolved
+		if (NumEdges == 0 || NumEdges != EdgeDataFacade->GetNum()) { return true; }
+
+		PCGEx::InitArray(EdgeKeys, NumEdges);
+		PCGEx::InitArray(Endpoints, NumEdges * 2);
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ClaimEdgesTask)
+
+		ClaimEdgesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CheckDuplicateEdges();
+			};
+
+		ClaimEdgesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ClaimEdges(Scope);
+			};
+
+		ClaimEdgesTask->StartSubLoops(NumEdges, GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
+
+		return true;
+	}
+
+	void FProcessor::ClaimEdges(const PCGExMT::FScope& Scope)
+	{
+		int32* Degrees = VtxDegrees->GetData();
+		int32* Owners = VtxOwners->GetData();
+
+		auto ClaimVtx = [&](const int32 Vtx)
+		{
+			FPlatformAtomics::InterlockedIncrement(Degrees + Vtx);
+			const int32 Owner = FPlatformAtomics::InterlockedCompareExchange(Owners + Vtx, BatchIndex, -1);
+			if (Owner != -1 && Owner != BatchIndex) { FPlatformAtomics::InterlockedExchange(&bIntegrityValid, 0); }
+		};
+
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const PCGExGraph::FEdge& Edge = IndexedEdges[i];
+
+			EdgeKeys[i] = PCGEx::H64U(Edge.Start, Edge.End);
+			Endpoints[i * 2] = Edge.Start;
+			Endpoints[i * 2 + 1] = Edge.End;
+
+			if (Edge.Start == Edge.End)
+			{
+				FPlatformAtomics::InterlockedExchange(&bIntegrityValid, 0);
+				continue;
+			}
+
+			ClaimVtx(Edge.Start);
+			ClaimVtx(Edge.End);
+		}
+	}
+
+	void FProcessor::CheckDuplicateEdges()
+	{
+		if (!bIntegrityValid) { return; }
+
+		PCGExMT::ParallelSort(
+			AsyncManager, EdgeKeys, TLess<uint64>(),
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->ScanSortedEdgeKeys();
+			});
+	}
+
+	void FProcessor::ScanSortedEdgeKeys()
+	{
+		const int32 NumPairs = EdgeKeys.Num() - 1;
+		if (NumPairs <= 0)
+		{
+			CheckConnectivity();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, DuplicateEdgesTask)
+
+		DuplicateEdgesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CheckConnectivity();
+			};
+
+		DuplicateEdgesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				PCGEX_SCOPE_LOOP(i)
+				{
+					if (This->EdgeKeys[i] != This->EdgeKeys[i + 1]) { continue; }
+					FPlatformAtomics::InterlockedExchange(&This->bIntegrityValid, 0);
+					return;
+				}
+			};
+
+		DuplicateEdgesTask->StartSubLoops(NumPairs, GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
+	}
+
+	void FProcessor::CheckConnectivity()
+	{
+		if (!bIntegrityValid) { return; }
+
+		// Connectivity, as a union-find over the compacted vtx of this edge set
+
+		PCGExMT::ParallelSort(
+			AsyncManager, Endpoints, TLess<int32>(),
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->RemapEdges();
+			});
+	}
+
+	void FProcessor::RemapEdges()
+	{
+		Endpoints.SetNum(Algo::Unique(Endpoints));
+		NumClusterVtx = Endpoints.Num();
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, RemapEdgesTask)
+
+		RemapEdgesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->FindComponents();
+			};
+
+		RemapEdgesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				PCGEX_SCOPE_LOOP(i)
+				{
+					const PCGExGraph::FEdge& Edge = This->IndexedEdges[i];
+					This->EdgeKeys[i] = PCGEx::H64(Algo::LowerBound(This->Endpoints, Edge.Start), Algo::LowerBound(This->Endpoints, Edge.End));
+				}
+			};
+
+		RemapEdgesTask->StartSubLoops(IndexedEdges.Num(), GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
+	}
+
+	void FProcessor::FindComponents()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSanitizeClusters::FindComponents);
+
+		TArray<int32> Parents;
+		PCGEx::InitArray(Parents, NumClusterVtx);
+		for (int i = 0; i < NumClusterVtx; i++) { Parents[i] = i; }
+
+		auto FindRoot = [&](int32 Index)
+		{
+			while (Parents[Index] != Index)
+			{
+				Parents[Index] = Parents[Parents[Index]];
+				Index = Parents[Index];
+			}
+			return Index;
+		};
+
+		int32 NumComponents = NumClusterVtx;
+		for (const uint64 EdgeKey : EdgeKeys)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(EdgeKey, A, B);
+
+			const int32 RootA = FindRoot(A);
+			const int32 RootB = FindRoot(B);
+			if (RootA == RootB) { continue; }
+
+			Parents[RootA] = RootB;
+			NumComponents--;
+		}
+
+		EdgeKeys.Empty();
+		Endpoints.Empty();
+
+		bIsClean = NumComponents == 1;
+	}
+
+	void FProcessor::CompleteWork()
+	{
+		// Only reached when the whole batch is clean : edges are output as-is,
+		// only refreshing the properties the graph builder would have written.
+
+		const FPCGExGraphBuilderDetails& Details = Context->GraphBuilderDetails;
+
+		if (!Details.bWriteEdgePosition && !Details.bOutputEdgeLength && !Details.bRefreshEdgeSeed)
+		{
+			PCGEX_INIT_IO_VOID(EdgeDataFacade->Source, PCGExData::EIOInit::Forward)
+			return;
+		}
+
+		PCGEX_INIT_IO_VOID(EdgeDataFacade->Source, PCGExData::EIOInit::Duplicate)
+
+		EPCGPointNativeProperties AllocateProperties = EPCGPointNativeProperties::Seed;
+
+		if (Details.bWriteEdgePosition)
+		{
+			AllocateProperties |= EPCGPointNativeProperties::Transform;
+
+			if (Details.BasicEdgeSolidification.SolidificationAxis != EPCGExMinimalAxis::None)
+			{
+				AllocateProperties |= EPCGPointNativeProperties::BoundsMin;
+				AllocateProperties |= EPCGPointNativeProperties::BoundsMax;
+			}
+		}
+
+		EdgeDataFacade->GetOut()->AllocateProperties(AllocateProperties);
+
+		if (Details.bOutputEdgeLength)
+		{
+			if (!PCGEx::IsWritableAttributeName(Details.EdgeLengthName))
+			{
+				PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("Invalid user-defined attribute name for Edge Length."));
+			}
+			else
+			{
+				EdgeLength = EdgeDataFacade->GetWritable<double>(Details.EdgeLengthName, 0, true, PCGExData::EBufferInit::New);
+			}
+		}
+
+		StartParallelLoopForRange(IndexedEdges.Num());
+	}
+
+	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
+	{
+		const FPCGExGraphBuilderDetails& Details = Context->GraphBuilderDetails;
+
+		TPCGValueRange<int32> EdgeSeeds = EdgeDataFacade->GetOut()->GetSeedValueRange(false);
+		const FVector SeedOffset = FVector(EdgeDataFacade->Source->IOIndex);
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			const PCGExGraph::FEdge& Edge = IndexedEdges[Index];
+
+			PCGExData::FMutablePoint EdgePt = EdgeDataFacade->GetOutPoint(Edge.PointIndex);
+			const PCGExData::FConstPoint StartPt = VtxDataFacade->GetOutPoint(Edge.Start);
+			const PCGExData::FConstPoint EndPt = VtxDataFacade->GetOutPoint(Edge.End);
+
+			if (Details.bWriteEdgePosition) { Details.BasicEdgeSolidification.Mutate(EdgePt, StartPt, EndPt, Details.EdgePosition); }
+			if (EdgeLength) { EdgeLength->SetValue(Edge.PointIndex, FVector::Dist(StartPt.GetLocation(), EndPt.GetLocation())); }
+
+			int32& EdgeSeed = EdgeSeeds[Edge.PointIndex];
+			if (EdgeSeed == 0 || Details.bRefreshEdgeSeed) { EdgeSeed = PCGExRandom::ComputeSpatialSeed(EdgePt.GetLocation(), SeedOffset); }
+		}
+	}
+
+	void FProcessor::OnRangeProcessingComplete()
+	{
+		EdgeDataFacade->WriteFastest(AsyncManager);
+	}
+
+	void FProcessor::Output()
+	{
+		EdgeDataFacade->Source->StageOutput(ExecutionContext);
+	}
+
+	void FBatch::Process()
+	{
+		const int32 NumVtx = VtxDataFacade->GetNum();
+		VtxDegrees.Init(0, NumVtx);
+		VtxOwners.Init(-1, NumVtx);
+
+		TBatch<FProcessor>::Process();
+	}
+
+	bool FBatch::PrepareSingle(const TSharedPtr<FProcessor>& ClusterProcessor)
+	{
+		if (!TBatch<FProcessor>::PrepareSingle(ClusterProcessor)) { return false; }
+
+		ClusterProcessor->VtxDegrees = &VtxDegrees;
+		ClusterProcessor->VtxOwners = &VtxOwners;
+
 		return true;
 	}
 
+	bool FBatch::AreProcessorsClean()
+	{
+		if (Processors.Num() != Edges.Num()) { return false; }
+
+		for (const TSharedRef<FProcessor>& Processor : Processors)
+		{
+			if (!Processor->bIsProcessorValid || !Processor->bIsClean) { return false; }
+
+			// Clusters the graph builder would filter out
+			if (!GraphBuilderDetails.IsValid(Processor->NumClusterVtx, Processor->IndexedEdges.Num())) { return false; }
+		}
+
+		return !VtxDegrees.IsEmpty();
+	}
+
 	void FBatch::CompleteWork()
 	{
+		if (!AreProcessorsClean())
+		{
+			Rebuild();
+			return;
+		}
+
+		// Every vtx must be part of a cluster, with as many edges as its endpoint data expects
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, CheckDegreesTask)
+
+		CheckDegreesTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+
+				if (!This->bDegreesMatch)
+				{
+					This->Rebuild();
+					return;
+				}
+
+				This->bIsClean = true;
+				This->VtxDegrees.Empty();
+				This->VtxOwners.Empty();
+
+				This->TBatch<FProcessor>::CompleteWork();
+			};
+
+		CheckDegreesTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+
+				PCGEX_SCOPE_LOOP(i)
+				{
+					if (This->VtxDegrees[i] == 0 || This->VtxDegrees[i] != This->ExpectedAdjacency[i])
+					{
+						FPlatformAtomics::InterlockedExchange(&This->bDegreesMatch, 0);
+						return;
+					}
+				}
+			};
+
+		CheckDegreesTask->StartSubLoops(VtxDegrees.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FBatch::Rebuild()
+	{
+		bIsClean = false;
+
+		VtxDegrees.Empty();
+		VtxOwners.Empty();
+
+		for (const TSharedRef<FProcessor>& Processor : Processors)
+		{
+			if (!Processor->IndexedEdges.IsEmpty()) { GraphBuilder->Graph->InsertEdges(Processor->IndexedEdges); }
+			Processor->IndexedEdges.Empty();
+		}
+
 		GraphBuilder->Compile(AsyncManager, true);
 	}
 
 	void FBatch::Output()
 	{
+		if (bIsClean)
+		{
+			TBatch<FProcessor>::Output();
+			return;
+		}
+
 		if (GraphBuilder->bCompiledSuccessfully) { GraphBuilder->StageEdgesOutputs(); }
 		else { GraphBuilder->NodeDataFacade->Source->InitializeOutput(PCGExData::EIOInit::NoInit); }
 	}
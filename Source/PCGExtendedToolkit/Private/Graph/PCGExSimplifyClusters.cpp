@@ -150,24 +150,23 @@ namespace PCGExSimplifyClusters
 	{
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const TSharedPtr<PCGExCluster::FNodeChain> Chain = ChainBuilder->Chains[Index];
-			if (!Chain) { continue; }
+			const PCGExCluster::FNodeChain& Chain = ChainBuilder->Chains[Index];
 
-			if (Settings->bPruneLeaves && Chain->bIsLeaf) { continue; } // Skip leaf
+			if (Settings->bPruneLeaves && Chain.bIsLeaf) { continue; } // Skip leaf
 
 			const bool bComputeMeta = Settings->EdgeUnionData.WriteAny();
 
-			if (Settings->bOperateOnLeavesOnly && !Chain->bIsLeaf)
+			if (Settings->bOperateOnLeavesOnly && !Chain.bIsLeaf)
 			{
-				Chain->Dump(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
+				Chain.Dump(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
 				continue;
 			}
 
-			if (Chain->SingleEdge != -1 || !Settings->bMergeAboveAngularThreshold)
+			if (Chain.SingleEdge != -1 || !Settings->bMergeAboveAngularThreshold)
 			{
 				// TODO : When using reduced dump we know in advance the number of edges will be the number of chains (optionally minus leaves)
 				// We can pre-populate the graph union data
-				Chain->DumpReduced(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
+				Chain.DumpReduced(Cluster.ToSharedRef(), GraphBuilder->Graph, bComputeMeta);
 				continue;
 			}
 
@@ -176,9 +175,9 @@ namespace PCGExSimplifyClusters
 
 			PCGExGraph::FEdge OutEdge = PCGExGraph::FEdge{};
 
-			const TArray<PCGExGraph::FLink>& Links = Chain->Links;
+			const TConstArrayView<PCGExGraph::FLink> Links = Chain.Links;
 
-			int32 LastIndex = Chain->Seed.Node;
+			int32 LastIndex = Chain.Seed.Node;
 			int32 UnionCount = 0;
 
 			const int32 MaxIndex = Links.Num() - 1;
@@ -195,7 +194,7 @@ namespace PCGExSimplifyClusters
 
 				const PCGExGraph::FLink Lk = Links[i];
 				const FVector A = Cluster->GetDir(Links[i - 1].Node, Lk.Node);
-				const int32 IndexB = (i == MaxIndex && Chain->bIsClosedLoop) ? 0 : i + 1;
+				const int32 IndexB = (i == MaxIndex && Chain.bIsClosedLoop) ? 0 : i + 1;
 
 				if (!Links.IsValidIndex(IndexB)) { continue; }
 
@@ -251,18 +250,18 @@ namespace PCGExSimplifyClusters
 				MergedEdges.Reset();
 			};
 
-			if (LastIndex != Chain->Links.Last().Node)
+			if (LastIndex != Chain.Links.Last().Node)
 			{
 				// Last processed point is not the last; likely skipped by angular threshold.
-				const int32 LastNode = Chain->Links.Last().Node;
-				MakeLastEdge(Chain->Links.Last());
+				const int32 LastNode = Chain.Links.Last().Node;
+				MakeLastEdge(Chain.Links.Last());
 				LastIndex = LastNode; // Update last index
 			}
 
-			if (Chain->bIsClosedLoop)
+			if (Chain.bIsClosedLoop)
 			{
 				// Wrap
-				MakeLastEdge(Chain->Seed);
+				MakeLastEdge(Chain.Seed);
 			}
 		}
 	}
@@ -4,12 +4,31 @@
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristicFeedback.h"
 
 
-double FPCGExHeuristicFeedback::GetGlobalScore(const PCGExCluster::FNode& From, const PCGExCluster::FNode& Seed, const PCGExCluster::FNode& Goal) const
+void FPCGExHeuristicFeedback::PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster)
 {
-	FReadScopeLock ReadScopeLock(FeedbackLock);
+	FPCGExHeuristicOperation::PrepareForCluster(InCluster);
+
+	if (!bGlobal)
+	{
+		LocalNodeFeedbackNum.Reset();
+		LocalEdgeFeedbackNum.Reset();
+		return;
+	}
+
+	NodeFeedbackNum.Init(0, InCluster->Nodes->Num());
+	EdgeFeedbackNum.Init(0, InCluster->Edges->Num());
+
+	if (bBatchSynchronous)
+	{
+		PendingNodeFeedbackNum.Init(0, NodeFeedbackNum.Num());
+		PendingEdgeFeedbackNum.Init(0, EdgeFeedbackNum.Num());
+	}
+}
 
-	const uint32* N = NodeFeedbackNum.Find(From.Index);
-	return N ? GetScoreInternal(NodeScale) * *N : GetScoreInternal(0);
+double FPCGExHeuristicFeedback::GetGlobalScore(const PCGExCluster::FNode& From, const PCGExCluster::FNode& Seed, const PCGExCluster::FNode& Goal) const
+{
+	const int32 N = GetNodeFeedback(From.Index);
+	return N ? GetScoreInternal(NodeScale) * N : GetScoreInternal(0);
 }
 
 double FPCGExHeuristicFeedback::GetEdgeScore(
@@ -20,58 +39,58 @@ double FPCGExHeuristicFeedback::GetEdgeScore(
 	const PCGExCluster::FNode& Goal,
 	const TSharedPtr<PCGEx::FHashLookup> TravelStack) const
 {
-	FReadScopeLock ReadScopeLock(FeedbackLock);
-
-	const uint32* N = NodeFeedbackNum.Find(To.Index);
-	const uint32* E = EdgeFeedbackNum.Find(Edge.Index);
+	const int32 N = GetNodeFeedback(To.Index);
+	const int32 E = GetEdgeFeedback(Edge.Index);
 
 	if (bBinary)
 	{
 		return N || E ? GetScoreInternal(1) : GetScoreInternal(0);
 	}
 
-	const double NW = N ? GetScoreInternal(NodeScale) * *N : GetScoreInternal(0);
-	const double EW = E ? GetScoreInternal(EdgeScale) * *E : GetScoreInternal(0);
+	const double NW = N ? GetScoreInternal(NodeScale) * N : GetScoreInternal(0);
+	const double EW = E ? GetScoreInternal(EdgeScale) * E : GetScoreInternal(0);
 
 	return (NW + EW);
 }
 
 void FPCGExHeuristicFeedback::FeedbackPointScore(const PCGExCluster::FNode& Node)
 {
-	FWriteScopeLock WriteScopeLock(FeedbackLock);
-
-	uint32& N = NodeFeedbackNum.FindOrAdd(Node.Index, 0);
-	N++;
+	AddNodeFeedback(Node.Index);
 
 	if (bBleed)
 	{
-		for (const PCGExGraph::FLink Lk : Node.Links)
-		{
-			uint32& E = EdgeFeedbackNum.FindOrAdd(Lk.Edge, 0);
-			E++;
-		}
+		for (const PCGExGraph::FLink Lk : Node.Links) { AddEdgeFeedback(Lk.Edge); }
 	}
 }
 
 void FPCGExHeuristicFeedback::FeedbackScore(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge)
 {
-	FWriteScopeLock WriteScopeLock(FeedbackLock);
-
-	uint32& N = NodeFeedbackNum.FindOrAdd(Node.Index, 0);
-	N++;
+	AddNodeFeedback(Node.Index);
 
 	if (bBleed)
 	{
-		for (const PCGExGraph::FLink Lk : Node.Links)
-		{
-			uint32& E = EdgeFeedbackNum.FindOrAdd(Lk.Edge, 0);
-			E++;
-		}
+		for (const PCGExGraph::FLink Lk : Node.Links) { AddEdgeFeedback(Lk.Edge); }
 	}
 	else
 	{
-		uint32& E = EdgeFeedbackNum.FindOrAdd(Edge.Index, 0);
-		E++;
+		AddEdgeFeedback(Edge.Index);
+	}
+}
+
+void FPCGExHeuristicFeedback::CommitFeedback()
+{
+	if (!bBatchSynchronous) { return; }
+
+	for (int i = 0; i < NodeFeedbackNum.Num(); i++)
+	{
+		NodeFeedbackNum[i] += PendingNodeFeedbackNum[i];
+		PendingNodeFeedbackNum[i] = 0;
+	}
+
+	for (int i = 0; i < EdgeFeedbackNum.Num(); i++)
+	{
+		EdgeFeedbackNum[i] += PendingEdgeFeedbackNum[i];
+		PendingEdgeFeedbackNum[i] = 0;
 	}
 }
 
@@ -83,6 +102,9 @@ TSharedPtr<FPCGExHeuristicOperation> UPCGExHeuristicsFactoryFeedback::CreateOper
 	NewOperation->EdgeScale = Config.VisitedEdgesWeightFactor;
 	NewOperation->bBleed = Config.bAffectAllConnectedEdges;
 	NewOperation->bBinary = Config.bBinary;
+	NewOperation->bGlobal = Config.bGlobalFeedback;
+	NewOperation->bBatchSynchronous = Config.bGlobalFeedback && Config.bBatchSynchronous;
+	NewOperation->BatchSize = Config.BatchSize;
 	return NewOperation;
 }
 
@@ -161,6 +161,22 @@ namespace PCGExHeuristics
 		for (const TSharedPtr<FPCGExHeuristicFeedback>& Op : Feedbacks) { Op->FeedbackScore(Node, Edge); }
 	}
 
+	int32 FHeuristicsHandler::GetFeedbackBatchSize() const
+	{
+		int32 BatchSize = MAX_int32;
+		for (const TSharedPtr<FPCGExHeuristicFeedback>& Op : Feedbacks)
+		{
+			if (!Op->bBatchSynchronous) { return 0; }
+			BatchSize = FMath::Min(BatchSize, FMath::Max(1, Op->BatchSize));
+		}
+		return Feedbacks.IsEmpty() ? 0 : BatchSize;
+	}
+
+	void FHeuristicsHandler::CommitFeedback()
+	{
+		for (const TSharedPtr<FPCGExHeuristicFeedback>& Op : Feedbacks) { Op->CommitFeedback(); }
+	}
+
 	FVector FHeuristicsHandler::GetSeedUVW() const
 	{
 		FVector UVW = FVector::ZeroVector;
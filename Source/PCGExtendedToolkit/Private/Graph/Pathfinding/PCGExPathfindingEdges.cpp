@@ -239,27 +239,65 @@ namespace PCGExPathfindingEdge
 			Queries[i] = Query;
 		}
 
+		if (const int32 FeedbackBatchSize = HeuristicsHandler->GetFeedbackBatchSize(); FeedbackBatchSize > 0)
+		{
+			// Batch-synchronous global feedback : waves are chained one after another,
+			// queries within a wave run in parallel against the feedback committed by previous waves.
+			StartQueryWave(0, FeedbackBatchSize);
+			return true;
+		}
+
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ResolveQueriesTask)
+
 		ResolveQueriesTask->OnIterationCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
+				This->ResolveQuery(Index);
+			};
 
-				TSharedPtr<PCGExPathfinding::FPathQuery> Query = This->Queries[Index];
-				Query->ResolvePicks(This->Settings->SeedPicking, This->Settings->GoalPicking);
+		ResolveQueriesTask->StartIterations(Queries.Num(), 1, HeuristicsHandler->HasGlobalFeedback());
+		return true;
+	}
 
-				if (!Query->HasValidEndpoints()) { return; }
+	void FProcessor::StartQueryWave(const int32 WaveStart, const int32 WaveSize)
+	{
+		const int32 WaveCount = FMath::Min(WaveSize, Queries.Num() - WaveStart);
+		if (WaveCount <= 0) { return; }
 
-				Query->FindPath(This->SearchOperation, This->HeuristicsHandler, nullptr);
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ResolveWaveTask)
 
-				if (!Query->IsQuerySuccessful()) { return; }
+		ResolveWaveTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, WaveStart, WaveSize]()
+			{
+				PCGEX_ASYNC_THIS
+				This->HeuristicsHandler->CommitFeedback();
+				This->StartQueryWave(WaveStart + WaveSize, WaveSize);
+			};
 
-				This->Context->BuildPath(Query);
-				Query->Cleanup();
+		ResolveWaveTask->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE, WaveStart](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ResolveQuery(WaveStart + Index);
 			};
 
-		ResolveQueriesTask->StartIterations(Queries.Num(), 1, HeuristicsHandler->HasGlobalFeedback());
-		return true;
+		ResolveWaveTask->StartIterations(WaveCount, 1);
+	}
+
+	void FProcessor::ResolveQuery(const int32 Index)
+	{
+		TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
+		Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
+
+		if (!Query->HasValidEndpoints()) { return; }
+
+		Query->FindPath(SearchOperation, HeuristicsHandler, nullptr);
+
+		if (!Query->IsQuerySuccessful()) { return; }
+
+		Context->BuildPath(Query);
+		Query->Cleanup();
 	}
 }
 
@@ -65,6 +65,19 @@ bool PCGExPointFilter::FBitmaskFilter::Test(const TSharedPtr<PCGExData::FPointIO
 	return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 }
 
+void PCGExPointFilter::FBitmaskFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+{
+	TArray<int64> Flags;
+	TArray<int64> Masks;
+	Flags.SetNumUninitialized(Scope.Count);
+	Masks.SetNumUninitialized(Scope.Count);
+
+	FlagsReader->ReadScope(Scope.Start, Flags);
+	MaskReader->ReadScope(Scope.Start, Masks);
+
+	PCGExCompare::CompareScope(TypedFilterFactory->Config.Comparison, Flags, Masks, InOutMask, TypedFilterFactory->Config.bInvertResult);
+}
+
 PCGEX_CREATE_FILTER_FACTORY(Bitmask)
 
 #if WITH_EDITOR
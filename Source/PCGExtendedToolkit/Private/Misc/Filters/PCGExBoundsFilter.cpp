@@ -68,13 +68,13 @@ bool PCGExPointFilter::FBoundsFilter::Init(FPCGExContext* InContext, const TShar
 
 #define PCGEX_TEST_BOUNDS(_NAME, _BOUNDS, _TEST)\
 case EPCGExBoxCheckMode::_TEST:\
-	BoundCheck = [&](const PCGExData::FConstPoint& Point) { if (bCheckAgainstDataBounds) { return bCollectionTestResult; } for(const TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud : *Clouds){ if(Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
-	BoundCheckProxy = [&](const PCGExData::FProxyPoint& Point) { for(const TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud : *Clouds){ if(Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
+	BoundCheck = [&](const PCGExData::FConstPoint& Point) { if (bCheckAgainstDataBounds) { return bCollectionTestResult; } for(const TSharedPtr<PCGExGeo::FPointBoxCloud>& Cloud : *Clouds){ if(Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
+	BoundCheckProxy = [&](const PCGExData::FProxyPoint& Point) { for(const TSharedPtr<PCGExGeo::FPointBoxCloud>& Cloud : *Clouds){ if(Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
 	break;
 #define PCGEX_TEST_BOUNDS_INV(_NAME, _BOUNDS, _TEST)\
 case EPCGExBoxCheckMode::_TEST:\
-	BoundCheck = [&](const PCGExData::FConstPoint& Point) { if (bCheckAgainstDataBounds) { return bCollectionTestResult; } for(const TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud : *Clouds){ if(!Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
-	BoundCheckProxy = [&](const PCGExData::FProxyPoint& Point) { for(const TSharedPtr<PCGExGeo::FPointBoxCloud> Cloud : *Clouds){ if(!Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
+	BoundCheck = [&](const PCGExData::FConstPoint& Point) { if (bCheckAgainstDataBounds) { return bCollectionTestResult; } for(const TSharedPtr<PCGExGeo::FPointBoxCloud>& Cloud : *Clouds){ if(!Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
+	BoundCheckProxy = [&](const PCGExData::FProxyPoint& Point) { for(const TSharedPtr<PCGExGeo::FPointBoxCloud>& Cloud : *Clouds){ if(!Cloud->_NAME<EPCGExPointBoundsSource::_BOUNDS, EPCGExBoxCheckMode::_TEST>(Point)){return true;} } return false;};\
 	break;
 #define PCGEX_FOREACH_TESTTYPE(_NAME, _BOUNDS)\
 case EPCGExPointBoundsSource::_BOUNDS:\
@@ -171,6 +171,25 @@ bool PCGExPointFilter::FBoundsFilter::Test(const TSharedPtr<PCGExData::FPointIO>
 	return Test(ProxyPoint);
 }
 
+void PCGExPointFilter::FBoundsFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+{
+	if (bCheckAgainstDataBounds)
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(InOutMask.GetData(), InOutMask.Num() * sizeof(int8)); }
+		return;
+	}
+
+	PCGExData::FConstPoint Point = PointDataFacade->Source->GetInPoint(Scope.Start);
+	PCGEX_SCOPE_LOOP(Index)
+	{
+		int8& Mask = InOutMask[Index - Scope.Start];
+		if (!Mask) { continue; }
+
+		Point.Index = Index;
+		Mask = BoundCheck(Point);
+	}
+}
+
 TArray<FPCGPinProperties> UPCGExBoundsFilterProviderSettings::InputPinProperties() const
 {
 	TArray<FPCGPinProperties> PinProperties = Super::InputPinProperties();
@@ -104,6 +104,40 @@ bool PCGExPointFilter::FDistanceFilter::Test(const TSharedPtr<PCGExData::FPointI
 	return Test(ProxyPoint);
 }
 
+void PCGExPointFilter::FDistanceFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+{
+	if (bCheckAgainstDataBounds)
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(InOutMask.GetData(), InOutMask.Num() * sizeof(int8)); }
+		return;
+	}
+
+	TArray<double> Distances;
+	TArray<double> Thresholds;
+	Distances.SetNumUninitialized(Scope.Count);
+	Thresholds.SetNumUninitialized(Scope.Count);
+
+	DistanceThresholdGetter->ReadScope(Scope.Start, Thresholds);
+
+	// Nearest target lookups are the expensive part, only run them for what's still selected
+	PCGExData::FConstPoint TargetPt;
+	PCGEX_SCOPE_LOOP(Index)
+	{
+		const int32 i = Index - Scope.Start;
+		if (!InOutMask[i])
+		{
+			Distances[i] = 0;
+			continue;
+		}
+
+		double BestDist = MAX_dbl;
+		TargetsHandler->FindClosestTarget(PointDataFacade->Source->GetInPoint(Index), TargetPt, BestDist, &IgnoreList);
+		Distances[i] = FMath::Sqrt(BestDist);
+	}
+
+	PCGExCompare::CompareScope<double>(TypedFilterFactory->Config.Comparison, Distances, Thresholds, InOutMask, TypedFilterFactory->Config.Tolerance);
+}
+
 TArray<FPCGPinProperties> UPCGExDistanceFilterProviderSettings::InputPinProperties() const
 {
 	TArray<FPCGPinProperties> PinProperties = Super::InputPinProperties();
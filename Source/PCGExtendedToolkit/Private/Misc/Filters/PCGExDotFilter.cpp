@@ -75,6 +75,35 @@ bool PCGExPointFilter::FDotFilter::Test(const int32 PointIndex) const
 		PointIndex);
 }
 
+void PCGExPointFilter::FDotFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+{
+	TArray<FVector> A;
+	TArray<FVector> B;
+	TArray<double> Dots;
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+	Dots.SetNumUninitialized(Scope.Count);
+
+	OperandA->ReadScope(Scope.Start, A);
+	OperandB->ReadScope(Scope.Start, B);
+
+	const bool bTransformA = TypedFilterFactory->Config.bTransformOperandA;
+	const bool bTransformB = TypedFilterFactory->Config.bTransformOperandB;
+
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		FVector VA = A[i] * OperandAMultiplier;
+		FVector VB = B[i].GetSafeNormal() * OperandBMultiplier;
+
+		if (bTransformA) { VA = InTransforms[Scope.Start + i].TransformVectorNoScale(VA); }
+		if (bTransformB) { VB = InTransforms[Scope.Start + i].TransformVectorNoScale(VB); }
+
+		Dots[i] = FVector::DotProduct(VA, VB);
+	}
+
+	DotComparison.TestScope(Scope.Start, Dots, InOutMask);
+}
+
 bool PCGExPointFilter::FDotFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGEX_SHARED_CONTEXT(IO->GetContextHandle())
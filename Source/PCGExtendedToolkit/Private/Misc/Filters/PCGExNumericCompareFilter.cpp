@@ -71,6 +71,19 @@ bool PCGExPointFilter::FNumericCompareFilter::Test(const TSharedPtr<PCGExData::F
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FNumericCompareFilter::TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const
+{
+	TArray<double> A;
+	TArray<double> B;
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+
+	OperandA->ReadScope(Scope.Start, A);
+	OperandB->ReadScope(Scope.Start, B);
+
+	PCGExCompare::CompareScope<double>(TypedFilterFactory->Config.Comparison, A, B, InOutMask, TypedFilterFactory->Config.Tolerance);
+}
+
 PCGEX_CREATE_FILTER_FACTORY(NumericCompare)
 
 #if WITH_EDITOR
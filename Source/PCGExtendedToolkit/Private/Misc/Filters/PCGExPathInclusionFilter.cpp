@@ -24,8 +24,12 @@ bool UPCGExPathInclusionFilterFactory::Prepare(FPCGExContext* InContext, const T
 
 	Splines = MakeShared<TArray<TSharedPtr<FPCGSplineStruct>>>();
 	TArray<FBox> BoundsList;
+	TArray<double> SegmentPaddings;
 	FBox OctreeBounds = FBox(ForceInit);
 
+	// Linear paths can reject "On" tests on a segment grid, as long as the polygon projection is used for inclusion
+	const bool bUseSegmentGrids = Config.bTestInclusionOnProjection && Config.PointType == EPCGExSplinePointTypeRedux::Linear;
+
 	if (Config.bTestInclusionOnProjection) { Polygons = MakeShared<TArray<TArray<FVector2D>>>(); }
 
 	if (TArray<FPCGTaggedData> Targets = InContext->InputData.GetInputsByPin(PCGExPaths::SourcePathsLabel);
@@ -69,6 +73,23 @@ bool UPCGExPathInclusionFilterFactory::Prepare(FPCGExContext* InContext, const T
 				//Projection.RotateVector(Pos)
 				for (int i = 0; i < NumPoints; i++) { Polygon[i] = FVector2D(InTransforms[i].GetLocation()); }
 				if (!PCGExGeo::IsWinded(EPCGExWinding::CounterClockwise, UE::Geometry::CurveUtil::SignedArea2<double, FVector2D>(Polygon) < 0)) { Algo::Reverse(Polygon); }
+
+				if (bUseSegmentGrids)
+				{
+					// Mirrors the "On" check : DistSquared < |Scale.YZ| * ToleranceSquared
+					double MaxScaleFactor = UE_SQRT_2;
+					if (Config.bSplineScalesTolerance)
+					{
+						MaxScaleFactor = 0;
+						for (int i = 0; i < NumPoints; i++)
+						{
+							const FVector S = InTransforms[i].GetScale3D();
+							MaxScaleFactor = FMath::Max(MaxScaleFactor, FVector2D(S.Y, S.Z).Length());
+						}
+					}
+
+					SegmentPaddings.Add(FMath::Sqrt(MaxScaleFactor) * Config.Tolerance + UE_KINDA_SMALL_NUMBER);
+				}
 			}
 
 			TSharedPtr<FPCGSplineStruct> SplineStruct = PCGExPaths::MakeSplineFromPoints(PathData->GetConstTransformValueRange(), Config.PointType, bIsClosedLoop, true);
@@ -88,6 +109,22 @@ bool UPCGExPathInclusionFilterFactory::Prepare(FPCGExContext* InContext, const T
 		for (int i = 0; i < BoundsList.Num(); i++) { Octree->AddElement(PCGEx::FIndexedItem(i, BoundsList[i])); }
 	}
 
+	if (Config.bTestInclusionOnProjection)
+	{
+		// Grids reference polygon data, only build them once all polygons are in place
+		PolygonGrids = MakeShared<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>>();
+		PolygonGrids->Reserve(Polygons->Num());
+		for (const TArray<FVector2D>& Polygon : *Polygons) { PolygonGrids->Add(MakeShared<PCGExGeo::FPolygonInclusionGrid>(Polygon)); }
+
+		if (bUseSegmentGrids)
+		{
+			// Polygons are always closed; an extra closing segment on open paths only makes rejection more conservative
+			SegmentGrids = MakeShared<TArray<TSharedPtr<PCGExGeo::FSegmentGrid2D>>>();
+			SegmentGrids->Reserve(Polygons->Num());
+			for (int i = 0; i < Polygons->Num(); i++) { SegmentGrids->Add(MakeShared<PCGExGeo::FSegmentGrid2D>((*Polygons)[i], true, SegmentPaddings[i])); }
+		}
+	}
+
 	return true;
 }
 
@@ -98,6 +135,8 @@ TSharedPtr<PCGExPointFilter::IFilter> UPCGExPathInclusionFilterFactory::CreateFi
 
 void UPCGExPathInclusionFilterFactory::BeginDestroy()
 {
+	SegmentGrids.Reset();
+	PolygonGrids.Reset();
 	Splines.Reset();
 	Super::BeginDestroy();
 }
@@ -355,7 +394,7 @@ namespace PCGExPointFilter
 
 	void FPathInclusionFilter::UpdateInclusionFast(const FVector& Pos, const int32 TargetIndex, ESplineCheckFlags& OutFlags, int32& OutInclusionsCount) const
 	{
-		if (FGeomTools2D::IsPointInPolygon(FVector2D(Pos), *(Polygons->GetData() + TargetIndex)))
+		if (IsInsidePolygon(Pos, TargetIndex))
 		{
 			OutInclusionsCount++;
 			EnumAddFlags(OutFlags, Inside);
@@ -390,7 +429,7 @@ namespace PCGExPointFilter
 		}
 		else
 		{
-			if (FGeomTools2D::IsPointInPolygon(FVector2D(Pos), *(Polygons->GetData() + TargetIndex)))
+			if (IsInsidePolygon(Pos, TargetIndex))
 			{
 				EnumAddFlags(OutFlags, Inside);
 				EnumRemoveFlags(OutFlags, Outside);
@@ -405,6 +444,26 @@ namespace PCGExPointFilter
 
 	void FPathInclusionFilter::UpdateInclusion(const FVector& Pos, const int32 TargetIndex, ESplineCheckFlags& OutFlags, int32& OutInclusionsCount) const
 	{
+		if (SegmentGrids)
+		{
+			int32 SegmentIndex = -1;
+			if ((SegmentGrids->GetData() + TargetIndex)->Get()->FindClosestSegment(FVector2D(Pos), SegmentIndex) == MAX_dbl)
+			{
+				// No segment within tolerance, can't be "On"; inclusion is resolved on the projected polygon
+				if (IsInsidePolygon(Pos, TargetIndex))
+				{
+					OutInclusionsCount++;
+					EnumAddFlags(OutFlags, Inside);
+				}
+				else
+				{
+					EnumAddFlags(OutFlags, Outside);
+				}
+
+				return;
+			}
+		}
+
 		const FTransform T = PCGExPaths::GetClosestTransform(*(Splines->GetData() + TargetIndex), Pos, TypedFilterFactory->Config.bSplineScalesTolerance);
 		const FVector& TLoc = T.GetLocation();
 		if (const FVector S = T.GetScale3D(); FVector::DistSquared(Pos, TLoc) < FVector2D(S.Y, S.Z).Length() * ToleranceSquared)
@@ -426,7 +485,7 @@ namespace PCGExPointFilter
 		}
 		else
 		{
-			if (FGeomTools2D::IsPointInPolygon(FVector2D(Pos), *(Polygons->GetData() + TargetIndex)))
+			if (IsInsidePolygon(Pos, TargetIndex))
 			{
 				OutInclusionsCount++;
 				EnumAddFlags(OutFlags, Inside);
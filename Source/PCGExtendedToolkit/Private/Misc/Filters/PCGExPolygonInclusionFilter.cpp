@@ -85,6 +85,11 @@ bool UPCGExPolygonInclusionFilterFactory::Prepare(FPCGExContext* InContext, cons
 		{
 			Octree = MakeShared<PCGEx::FIndexedItemOctree>(OctreeBounds.GetCenter(), OctreeBounds.GetExtent().Length());
 			for (int i = 0; i < Polygons->Num(); i++) { Octree->AddElement(PCGEx::FIndexedItem(i, Boxes[i])); }
+
+			// Per-polygon acceleration grid, so most points are resolved without walking polygon edges
+			Grids = MakeShared<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>>();
+			Grids->Reserve(Polygons->Num());
+			for (const TSharedPtr<TArray<FVector2D>>& Polygon : *Polygons) { Grids->Add(MakeShared<PCGExGeo::FPolygonInclusionGrid>(*Polygon)); }
 		}
 	}
 
@@ -105,6 +110,7 @@ TSharedPtr<PCGExPointFilter::IFilter> UPCGExPolygonInclusionFilterFactory::Creat
 void UPCGExPolygonInclusionFilterFactory::BeginDestroy()
 {
 	Octree.Reset();
+	Grids.Reset();
 	Polygons.Reset();
 	Super::BeginDestroy();
 }
@@ -143,7 +149,7 @@ namespace PCGExPointFilter
 				Box,
 				[&](const PCGEx::FIndexedItem& Item)
 				{
-					if (FGeomTools2D::IsPointInPolygon(Pos2D, *(Polygons->GetData() + Item.Index)->Get()))
+					if ((Grids->GetData() + Item.Index)->Get()->IsInside(Pos2D))
 					{
 						bResult = !bResult;
 						return false;
@@ -159,7 +165,7 @@ namespace PCGExPointFilter
 			Box,
 			[&](const PCGEx::FIndexedItem& Item)
 			{
-				if (FGeomTools2D::IsPointInPolygon(Pos2D, *(Polygons->GetData() + Item.Index)->Get())) { Inclusions++; }
+				if ((Grids->GetData() + Item.Index)->Get()->IsInside(Pos2D)) { Inclusions++; }
 			});
 
 		if (TypedFilterFactory->Config.bUseMinInclusionCount && TypedFilterFactory->Config.bUseMaxInclusionCount)
@@ -198,7 +204,7 @@ namespace PCGExPointFilter
 				Box,
 				[&](const PCGEx::FIndexedItem& Item)
 				{
-					if (FGeomTools2D::IsPointInPolygon(Pos2D, *(Polygons->GetData() + Item.Index)->Get()))
+					if ((Grids->GetData() + Item.Index)->Get()->IsInside(Pos2D))
 					{
 						bResult = !bResult;
 						return false;
@@ -214,7 +220,7 @@ namespace PCGExPointFilter
 			Box,
 			[&](const PCGEx::FIndexedItem& Item)
 			{
-				if (FGeomTools2D::IsPointInPolygon(Pos2D, *(Polygons->GetData() + Item.Index)->Get())) { Inclusions++; }
+				if ((Grids->GetData() + Item.Index)->Get()->IsInside(Pos2D)) { Inclusions++; }
 			});
 
 		if (TypedFilterFactory->Config.bUseMinInclusionCount && TypedFilterFactory->Config.bUseMaxInclusionCount)
@@ -16,6 +16,8 @@ MACRO(MaxValue, _TYPE, _TYPE{})\
 MACRO(SetMinValue, _TYPE, _TYPE{})\
 MACRO(SetMaxValue, _TYPE, _TYPE{})\
 MACRO(AverageValue, _TYPE, _TYPE{})\
+MACRO(MedianValue, _TYPE, _TYPE{})\
+MACRO(QuantileValue, _TYPE, _TYPE{})\
 MACRO(UniqueValuesNum, int32, 0)\
 MACRO(UniqueSetValuesNum, int32, 0)\
 MACRO(DifferentValuesNum, int32, 0)\
@@ -166,6 +168,144 @@ bool FPCGExAttributeStatsElement::ExecuteInternal(FPCGContext* InContext) const
 
 namespace PCGExAttributeStats
 {
+	void FHyperLogLog::Init(const int32 InPrecision)
+	{
+		Precision = FMath::Clamp(InPrecision, 4, 16);
+		Registers.Init(0, 1 << Precision);
+	}
+
+	void FHyperLogLog::Add(const uint64 Hash)
+	{
+		const uint32 Index = static_cast<uint32>(Hash >> (64 - Precision));
+		// Guard bit keeps the rank bounded when the remaining bits are all zero
+		const uint64 Remaining = (Hash << Precision) | (1ull << (Precision - 1));
+		const uint8 Rank = static_cast<uint8>(FMath::CountLeadingZeros64(Remaining) + 1);
+		if (Rank > Registers[Index]) { Registers[Index] = Rank; }
+	}
+
+	void FHyperLogLog::Merge(const FHyperLogLog& Other)
+	{
+		if (!IsValid())
+		{
+			*this = Other;
+			return;
+		}
+
+		check(Precision == Other.Precision)
+		for (int i = 0; i < Registers.Num(); i++) { Registers[i] = FMath::Max(Registers[i], Other.Registers[i]); }
+	}
+
+	double FHyperLogLog::Estimate() const
+	{
+		if (!IsValid()) { return 0; }
+
+		const double M = Registers.Num();
+		const double Alpha = M >= 128 ? 0.7213 / (1 + 1.079 / M) : M >= 64 ? 0.709 : M >= 32 ? 0.697 : 0.673;
+
+		double Sum = 0;
+		int32 Zeros = 0;
+		for (const uint8 Register : Registers)
+		{
+			Sum += FMath::Pow(2.0, -static_cast<double>(Register));
+			if (Register == 0) { Zeros++; }
+		}
+
+		const double Raw = Alpha * M * M / Sum;
+
+		// Small range correction (linear counting)
+		if (Raw <= 2.5 * M && Zeros > 0) { return M * FMath::Loge(M / Zeros); }
+		return Raw;
+	}
+
+	void FTDigest::Add(const double Value, const double Weight)
+	{
+		Pending.Add(FCentroid{Value, Weight});
+		TotalWeight += Weight;
+		Min = FMath::Min(Min, Value);
+		Max = FMath::Max(Max, Value);
+
+		if (Pending.Num() >= Compression * 5) { Compress(); }
+	}
+
+	void FTDigest::Merge(const FTDigest& Other)
+	{
+		if (Other.IsEmpty()) { return; }
+
+		Pending.Append(Other.Centroids);
+		Pending.Append(Other.Pending);
+		TotalWeight += Other.TotalWeight;
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+
+		Compress();
+	}
+
+	void FTDigest::Compress()
+	{
+		if (Pending.IsEmpty()) { return; }
+
+		Pending.Append(Centroids);
+		Centroids.Reset();
+
+		Pending.Sort([](const FCentroid& A, const FCentroid& B) { return A.Mean < B.Mean; });
+
+		// k1 scale function : k(q) = delta / 2PI * asin(2q - 1)
+		const double Scale = Compression / (2 * PI);
+		auto QLimit = [&](const double Q)
+		{
+			const double K = Scale * FMath::Asin(FMath::Clamp(2 * Q - 1, -1.0, 1.0)) + 1;
+			return K >= Scale * HALF_PI ? 1.0 : (FMath::Sin(K / Scale) + 1) * 0.5;
+		};
+
+		FCentroid Current = Pending[0];
+		double WeightSoFar = 0;
+		double Limit = QLimit(0);
+
+		for (int i = 1; i < Pending.Num(); i++)
+		{
+			const FCentroid& Next = Pending[i];
+
+			if ((WeightSoFar + Current.Weight + Next.Weight) / TotalWeight <= Limit)
+			{
+				Current.Weight += Next.Weight;
+				Current.Mean += (Next.Mean - Current.Mean) * Next.Weight / Current.Weight;
+				continue;
+			}
+
+			WeightSoFar += Current.Weight;
+			Centroids.Add(Current);
+			Limit = QLimit(WeightSoFar / TotalWeight);
+			Current = Next;
+		}
+
+		Centroids.Add(Current);
+		Pending.Reset();
+	}
+
+	double FTDigest::Quantile(const double Q)
+	{
+		Compress();
+
+		if (Centroids.IsEmpty()) { return 0; }
+		if (Centroids.Num() == 1) { return Centroids[0].Mean; }
+
+		const double Index = FMath::Clamp(Q, 0.0, 1.0) * TotalWeight;
+
+		// Interpolate between centroid centers; extremes are pinned to the observed min/max
+		double Cumulative = Centroids[0].Weight * 0.5;
+		if (Index <= Cumulative) { return FMath::Lerp(Min, Centroids[0].Mean, Cumulative > 0 ? Index / Cumulative : 0); }
+
+		for (int i = 0; i < Centroids.Num() - 1; i++)
+		{
+			const double Span = (Centroids[i].Weight + Centroids[i + 1].Weight) * 0.5;
+			if (Index <= Cumulative + Span) { return FMath::Lerp(Centroids[i].Mean, Centroids[i + 1].Mean, (Index - Cumulative) / Span); }
+			Cumulative += Span;
+		}
+
+		const double Tail = TotalWeight - Cumulative;
+		return FMath::Lerp(Centroids.Last().Mean, Max, Tail > 0 ? (Index - Cumulative) / Tail : 1);
+	}
+
 	FProcessor::~FProcessor()
 	{
 	}
@@ -175,6 +315,8 @@ namespace PCGExAttributeStats
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExAttributeStats::Process);
 
 		// Must be set before process for filters
+		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
+
 		if (!IProcessor::Process(InAsyncManager)) { return false; }
 
 		PCGEX_INIT_IO(PointDataFacade->Source, Settings->OutputToPoints == EPCGExStatsOutputToPoints::None ? PCGExData::EIOInit::Forward : PCGExData::EIOInit::Duplicate)
@@ -205,14 +347,23 @@ namespace PCGExAttributeStats
 		}
 
 
+		// Stats accumulate into per-scope partials alongside filtering, and are merged in CompleteWork
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, FilterScope)
 
+		FilterScope->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				for (const TSharedPtr<IAttributeStats>& Stat : This->Stats) { Stat->Init(This->PointDataFacade, This->Settings, Loops.Num()); }
+			};
+
 		FilterScope->OnSubLoopStartCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
 				This->PointDataFacade->Fetch(Scope);
 				This->FilterScope(Scope);
+				for (const TSharedPtr<IAttributeStats>& Stat : This->Stats) { Stat->ProcessScope(Scope, This->PointFilterCache); }
 			};
 
 		FilterScope->StartSubLoops(PointDataFacade->GetNum(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
@@ -227,7 +378,7 @@ namespace PCGExAttributeStats
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Stats[Scope.Start]->Process(This->PointDataFacade, This->Context, This->Settings, This->PointFilterCache);
+				This->Stats[Scope.Start]->Output(This->PointDataFacade, This->Context, This->Settings);
 			};
 
 		AttributeStatProcessing->StartSubLoops(Stats.Num(), 1);
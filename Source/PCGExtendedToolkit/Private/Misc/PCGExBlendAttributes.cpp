@@ -66,6 +66,7 @@ namespace PCGExBlendAttributes
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExBlendAttributes::Process);
 
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
+		bUsePointFilterBits = true;
 
 		if (!IProcessor::Process(InAsyncManager)) { return false; }
 
@@ -87,13 +88,14 @@ namespace PCGExBlendAttributes
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		PointDataFacade->Fetch(Scope);
-		FilterScope(Scope);
+		if (!FilterScope(Scope)) { return; }
 
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			if (!PointFilterCache[Index]) { continue; }
-			BlendOpsManager->BlendAutoWeight(Index, Index);
-		}
+		// Only visit the points that passed
+		TArray<int32> Selection;
+		Selection.Reserve(Scope.Count);
+		GatherFilteredIndices(Scope, Selection);
+
+		for (const int32 Index : Selection) { BlendOpsManager->BlendAutoWeight(Index, Index); }
 	}
 
 	void FProcessor::CompleteWork()
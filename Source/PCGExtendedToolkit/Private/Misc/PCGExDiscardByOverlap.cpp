@@ -53,28 +53,6 @@ void FPCGExOverlapScoresWeighting::Max(const FPCGExOverlapScoresWeighting& Other
 	DataScore = FMath::Max(DataScore, Other.DataScore);
 }
 
-TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::RegisterOverlap(
-	PCGExDiscardByOverlap::FProcessor* InA,
-	PCGExDiscardByOverlap::FProcessor* InB,
-	const FBox& InIntersection)
-{
-	const uint64 HashID = PCGEx::H64U(InA->BatchIndex, InB->BatchIndex);
-
-	{
-		FReadScopeLock ReadScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExDiscardByOverlap::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
-	}
-
-	{
-		FWriteScopeLock WriteScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExDiscardByOverlap::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
-
-		PCGEX_MAKE_SHARED(NewOverlap, PCGExDiscardByOverlap::FOverlap, InA, InB, InIntersection)
-		OverlapMap.Add(HashID, NewOverlap);
-		return NewOverlap;
-	}
-}
-
 void FPCGExDiscardByOverlapContext::UpdateMaxScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack)
 {
 	MaxScores.ResetMin();
@@ -173,9 +151,9 @@ bool FPCGExDiscardByOverlapElement::ExecuteInternal(FPCGContext* InContext) cons
 	PCGEX_EXECUTION_CHECK
 	PCGEX_ON_INITIAL_EXECUTION
 	{
-		if (!Context->StartBatchProcessingPoints<PCGExPointsMT::TBatch<PCGExDiscardByOverlap::FProcessor>>(
+		if (!Context->StartBatchProcessingPoints<PCGExDiscardByOverlap::FBatch>(
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry) { return true; },
-			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExDiscardByOverlap::FProcessor>>& NewBatch)
+			[&](const TSharedPtr<PCGExDiscardByOverlap::FBatch>& NewBatch)
 			{
 				NewBatch->bRequiresWriteStep = true; // Not really but we need the step
 			}))
@@ -207,18 +185,102 @@ bool FPCGExDiscardByOverlapElement::ExecuteInternal(FPCGContext* InContext) cons
 
 namespace PCGExDiscardByOverlap
 {
-	FOverlap::FOverlap(FProcessor* InManager, FProcessor* InManaged, const FBox& InIntersection):
-		Intersection(InIntersection), Manager(InManager), Managed(InManaged)
+	FSweepAndPrune::FSweepAndPrune(TArray<FBox>&& InBounds)
+		: Bounds(MoveTemp(InBounds))
 	{
-		HashID = PCGEx::H64U(InManager->BatchIndex, InManaged->BatchIndex);
 	}
 
-	void FProcessor::RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection)
+	void FSweepAndPrune::Start(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
 	{
-		FWriteScopeLock WriteScopeLock(RegistrationLock);
-		const TSharedPtr<FOverlap> Overlap = Context->RegisterOverlap(this, InOtherProcessor, Intersection);
-		if (Overlap->Manager == this) { ManagedOverlaps.Add(Overlap); }
-		Overlaps.Add(Overlap);
+		AsyncManager = InAsyncManager;
+
+		Order.Reset(Bounds.Num());
+		for (int i = 0; i < Bounds.Num(); i++) { if (Bounds[i].IsValid) { Order.Add(i); } }
+
+		if (Order.Num() < 2)
+		{
+			if (OnCompleteCallback) { OnCompleteCallback(); }
+			return;
+		}
+
+		PCGExMT::ParallelSort(
+			InAsyncManager, Order,
+			[this](const int32 A, const int32 B) { return SweepLess(A, B); },
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->StartSweep();
+			});
+	}
+
+	void FSweepAndPrune::StartSweep()
+	{
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, SweepBoundsTask)
+
+		SweepBoundsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				if (This->OnCompleteCallback) { This->OnCompleteCallback(); }
+			};
+
+		SweepBoundsTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopedPairs.SetNum(Loops.Num());
+			};
+
+		SweepBoundsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->SweepScope(Scope);
+			};
+
+		// Sweep cost per entry depends on how many neighbors overlap along X, keep scopes small so it balances out
+		SweepBoundsTask->StartSubLoops(Order.Num(), 64);
+	}
+
+	void FSweepAndPrune::SweepScope(const PCGExMT::FScope& Scope)
+	{
+		const int32 NumEntries = Order.Num();
+		TArray<FBoundsPair>& LocalPairs = ScopedPairs[Scope.LoopIndex];
+
+		PCGEX_SCOPE_LOOP(s)
+		{
+			const int32 i = Order[s];
+			const FBox& BoxA = Bounds[i];
+
+			for (int32 t = s + 1; t < NumEntries; t++)
+			{
+				const int32 j = Order[t];
+				const FBox& BoxB = Bounds[j];
+
+				if (BoxB.Min.X > BoxA.Max.X) { break; } // Sorted on X, nothing further can overlap
+
+				const FBox Intersection = BoxA.Overlap(BoxB);
+				if (!Intersection.IsValid) { continue; }
+
+				LocalPairs.Emplace(FMath::Min(i, j), FMath::Max(i, j), Intersection);
+			}
+		}
+	}
+
+	void FSweepAndPrune::GetPairs(TArray<FBoundsPair>& OutPairs) const
+	{
+		int32 NumPairs = 0;
+		for (const TArray<FBoundsPair>& LocalPairs : ScopedPairs) { NumPairs += LocalPairs.Num(); }
+
+		OutPairs.Reserve(OutPairs.Num() + NumPairs);
+		for (const TArray<FBoundsPair>& LocalPairs : ScopedPairs) { OutPairs.Append(LocalPairs); }
+	}
+
+	FOverlap::FOverlap(FProcessor* InManager, FProcessor* InManaged, const FBox& InIntersection):
+		Intersection(InIntersection), Manager(InManager), Managed(InManaged)
+	{
+		HashID = PCGEx::H64U(InManager->BatchIndex, InManaged->BatchIndex);
 	}
 
 	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack)
@@ -262,6 +324,14 @@ namespace PCGExDiscardByOverlap
 
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, BoundsPreparationTask)
 
+		BoundsPreparationTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopedBounds = MakeShared<PCGExMT::TScopedValue<FBox>>(Loops, FBox(ForceInit));
+				This->ScopedVolume = MakeShared<PCGExMT::TScopedNumericValue<double>>(Loops, 0);
+			};
+
 		// TODO : Optimisation for huge data set would be to first compute rough overlap
 		// and then only add points within the overlap to the octree, as opposed to every single point.
 		BoundsPreparationTask->OnCompleteCallback =
@@ -269,6 +339,11 @@ namespace PCGExDiscardByOverlap
 			{
 				PCGEX_ASYNC_THIS
 
+				This->Bounds = This->ScopedBounds->Flatten([](const FBox& A, const FBox& B) { return A + B; });
+				This->TotalVolume = This->ScopedVolume->Sum();
+				This->ScopedBounds.Reset();
+				This->ScopedVolume.Reset();
+
 				TConstPCGValueRange<float> Densities = This->InPoints->GetConstDensityValueRange();
 
 				This->Octree = MakeUnique<FPointBoundsOctree>(This->Bounds.GetCenter(), This->Bounds.GetExtent().Length());
@@ -297,7 +372,7 @@ namespace PCGExDiscardByOverlap
 						PCGExData::FConstPoint Point(This->InPoints, i);
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::ScaledBounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<FPointBounds> PtBounds = MakeShared<FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				};
 		}
@@ -316,7 +391,7 @@ namespace PCGExDiscardByOverlap
 						PCGExData::FConstPoint Point(This->InPoints, i);
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::DensityBounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<FPointBounds> PtBounds = MakeShared<FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				};
 		}
@@ -335,7 +410,7 @@ namespace PCGExDiscardByOverlap
 						PCGExData::FConstPoint Point(This->InPoints, i);
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::Bounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<FPointBounds> PtBounds = MakeShared<FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				};
 		}
@@ -420,50 +495,21 @@ namespace PCGExDiscardByOverlap
 
 	void FProcessor::CompleteWork()
 	{
-		// 2 - Find overlaps between large bounds, we'll be searching only there.
-
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PreparationTask)
-		PreparationTask->OnCompleteCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]()
-			{
-				PCGEX_ASYNC_THIS
-
-				if (This->Settings->TestMode == EPCGExOverlapTestMode::Fast)
-				{
-					for (const TSharedPtr<FOverlap>& Overlap : This->Overlaps)
-					{
-						Overlap->Stats.OverlapCount = 1;
-						Overlap->Stats.OverlapVolume = Overlap->Intersection.GetVolume();
-					}
-				}
-				else
-				{
-					// Require one more expensive step...
-					if (!This->ManagedOverlaps.IsEmpty())
-					{
-						This->StartParallelLoopForRange(This->ManagedOverlaps.Num(), 8);
-					}
-				}
-			};
+		// 2 - Overlaps between data bounds have been found by the context broad phase, we'll be searching only there.
 
-		PreparationTask->OnIterationCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+		if (Settings->TestMode == EPCGExOverlapTestMode::Fast)
+		{
+			for (const TSharedPtr<FOverlap>& Overlap : Overlaps)
 			{
-				PCGEX_ASYNC_THIS
-
-				const TSharedPtr<PCGExPointsMT::IBatch> Parent = This->ParentBatch.Pin();
-				const TSharedPtr<PCGExData::FFacade> OtherFacade = Parent->ProcessorFacades[Index];
-				if (This->PointDataFacade == OtherFacade) { return; } // Skip self
-
-				const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*Parent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
-
-				const FBox Intersection = This->Bounds.Overlap(OtherProcessor->GetBounds());
-				if (!Intersection.IsValid) { return; } // No overlap
-
-				This->RegisterOverlap(&OtherProcessor.Get(), Intersection);
-			};
-
-		PreparationTask->StartIterations(ParentBatch.Pin()->ProcessorFacades.Num(), 64);
+				Overlap->Stats.OverlapCount = 1;
+				Overlap->Stats.OverlapVolume = Overlap->Intersection.GetVolume();
+			}
+		}
+		else
+		{
+			// Require one more expensive step...
+			if (!ManagedOverlaps.IsEmpty()) { StartParallelLoopForRange(ManagedOverlaps.Num(), 8); }
+		}
 	}
 
 	void FProcessor::Write()
@@ -554,6 +600,64 @@ namespace PCGExDiscardByOverlap
 			RawScores.OverlapVolumeDensity)
 			*/
 	}
+
+	FBatch::FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+		: TBatch(InContext, InPointsCollection)
+	{
+	}
+
+	void FBatch::OnInitialPostProcess()
+	{
+		TBatch<FProcessor>::OnInitialPostProcess();
+
+		// All data bounds are known at this point; find overlapping pairs once and hand them to both processors.
+
+		TArray<FBox> CandidateBounds;
+
+		Candidates.Reserve(Processors.Num());
+		CandidateBounds.Reserve(Processors.Num());
+
+		for (const TSharedRef<FProcessor>& P : Processors)
+		{
+			if (!P->bIsProcessorValid) { continue; }
+			Candidates.Add(&P.Get());
+			CandidateBounds.Add(P->GetBounds());
+		}
+
+		SweepAndPrune = MakeShared<FSweepAndPrune>(MoveTemp(CandidateBounds));
+		SweepAndPrune->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->RegisterOverlaps();
+			};
+
+		SweepAndPrune->Start(AsyncManager);
+	}
+
+	void FBatch::RegisterOverlaps()
+	{
+		FPCGExDiscardByOverlapContext* Context = GetContext<FPCGExDiscardByOverlapContext>();
+
+		TArray<FBoundsPair> Pairs;
+		SweepAndPrune->GetPairs(Pairs);
+		SweepAndPrune.Reset();
+
+		Context->OverlapMap.Reserve(Pairs.Num());
+
+		for (const FBoundsPair& Pair : Pairs)
+		{
+			FProcessor* Manager = Candidates[Pair.A];
+			FProcessor* Managed = Candidates[Pair.B];
+
+			PCGEX_MAKE_SHARED(NewOverlap, FOverlap, Manager, Managed, Pair.Intersection)
+			Context->OverlapMap.Add(NewOverlap->HashID, NewOverlap);
+
+			Manager->Overlaps.Add(NewOverlap);
+			Manager->ManagedOverlaps.Add(NewOverlap);
+			Managed->Overlaps.Add(NewOverlap);
+		}
+	}
 }
 #undef LOCTEXT_NAMESPACE
 #undef PCGEX_NAMESPACE
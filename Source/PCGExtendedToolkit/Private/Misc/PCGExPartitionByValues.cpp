@@ -3,6 +3,7 @@
 
 #include "Misc/PCGExPartitionByValues.h"
 
+#include "Algo/BinarySearch.h"
 #include "Data/PCGExData.h"
 
 
@@ -61,12 +62,6 @@ namespace PCGExPartition
 		}
 	}
 
-	void FKPartition::Add(const int64 Index)
-	{
-		FWriteScopeLock WriteLock(PointLock);
-		Points.Add(Index);
-	}
-
 	void FKPartition::Register(TArray<TSharedPtr<FKPartition>>& Partitions)
 	{
 		if (!SubLayers.IsEmpty())
@@ -96,7 +91,7 @@ namespace PCGExPartition
 			Pair.Value->PartitionIndex = *ValuesIndices.Find(Pair.Value->PartitionKey); //Ordered index
 		}
 
-		Points.Sort([](const int32& A, const int32& B) { return A < B; });
+		// Points are already in ascending order, they're scattered scope after scope
 
 		ValuesIndices.Empty();
 		UniquePartitionKeys.Empty();
@@ -223,23 +218,208 @@ namespace PCGExPartitionByValues
 		return true;
 	}
 
+	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
+	{
+		if (!Settings->bSplitOutput) { return; }
+
+		ScopedRuleValues.Reset(Rules.Num());
+		for (int i = 0; i < Rules.Num(); i++) { ScopedRuleValues.Add(MakeShared<PCGExMT::TScopedSet<int64>>(Loops, 0)); }
+	}
+
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::PartitionByValues::ProcessPoints);
 
 		PointDataFacade->Fetch(Scope);
 
+		// Key extraction only, no shared state is touched here
+		for (int r = 0; r < Rules.Num(); r++)
+		{
+			PCGExPartition::FRule& Rule = Rules[r];
+
+			if (Settings->bSplitOutput)
+			{
+				TSet<int64>& UniqueValues = ScopedRuleValues[r]->Get_Ref(Scope);
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					const int64 KeyValue = Rule.Filter(Index);
+					Rule.FilteredValues[Index] = KeyValue;
+					UniqueValues.Add(KeyValue);
+				}
+			}
+			else
+			{
+				PCGEX_SCOPE_LOOP(Index) { Rule.FilteredValues[Index] = Rule.Filter(Index); }
+			}
+		}
+	}
+
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		if (!Settings->bSplitOutput) { return; }
+
+		// Merge per-rule unique values & compute mixed-radix strides
+		// so composite keys are both dense and collision-free
+
+		const int32 NumRules = Rules.Num();
+		RuleUniqueValues.SetNum(NumRules);
+		RuleStrides.SetNum(NumRules);
+
+		bool bKeyOverflow = false;
+		int64 Stride = 1;
+
+		for (int r = 0; r < NumRules; r++)
+		{
+			TSet<int64> UniqueValues;
+			ScopedRuleValues[r]->Collapse(UniqueValues);
+
+			RuleUniqueValues[r] = UniqueValues.Array();
+			RuleUniqueValues[r].Sort();
+
+			RuleStrides[r] = Stride;
+
+			const int64 NumValues = FMath::Max(1, RuleUniqueValues[r].Num());
+			if (static_cast<double>(Stride) * static_cast<double>(NumValues) >= static_cast<double>(MAX_int64)) { bKeyOverflow = true; }
+			else { Stride *= NumValues; }
+		}
+
+		ScopedRuleValues.Empty();
+
+		if (bKeyOverflow)
+		{
+			// Too many unique combinations to fit a composite key
+			BuildPartitionsSynchronous();
+			return;
+		}
+
+		const int32 NumPoints = PointDataFacade->GetNum();
+		PCGEx::InitArray(PointKeys, NumPoints);
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ComputePartitionKeys)
+
+		ComputePartitionKeys->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopedKeyCounts.SetNum(Loops.Num());
+			};
+
+		ComputePartitionKeys->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ComputeKeys(Scope);
+			};
+
+		ComputePartitionKeys->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->PrepareLeaves();
+			};
+
+		ComputePartitionKeys->StartSubLoops(NumPoints, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FProcessor::ComputeKeys(const PCGExMT::FScope& Scope)
+	{
+		TMap<int64, int32>& KeyCounts = ScopedKeyCounts[Scope.LoopIndex];
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
+			int64 Key = 0;
+			for (int r = 0; r < Rules.Num(); r++) { Key += Algo::BinarySearch(RuleUniqueValues[r], Rules[r].FilteredValues[Index]) * RuleStrides[r]; }
+
+			PointKeys[Index] = Key;
+			KeyCounts.FindOrAdd(Key, 0)++;
+		}
+	}
+
+	void FProcessor::PrepareLeaves()
+	{
+		TSet<int64> UniqueKeys;
+		for (const TMap<int64, int32>& KeyCounts : ScopedKeyCounts) { for (const TPair<int64, int32>& Pair : KeyCounts) { UniqueKeys.Add(Pair.Key); } }
+
+		TArray<int64> SortedKeys = UniqueKeys.Array();
+		SortedKeys.Sort();
+		UniqueKeys.Empty();
+
+		// Build the partition hierarchy from unique combinations only
+
+		const int32 NumRules = Rules.Num();
+		const int32 NumLeaves = SortedKeys.Num();
+
+		Leaves.SetNum(NumLeaves);
+		KeyToLeaf.Reserve(NumLeaves);
+
+		for (int i = 0; i < NumLeaves; i++)
+		{
+			const int64 Key = SortedKeys[i];
+			KeyToLeaf.Add(Key, i);
+
 			TSharedPtr<PCGExPartition::FKPartition> Partition = RootPartition;
-			for (PCGExPartition::FRule& Rule : Rules)
+			for (int r = 0; r < NumRules; r++)
 			{
-				const int64 KeyValue = Rule.Filter(Index);
-				Partition = Partition->GetPartition(KeyValue, &Rule);
-				Rule.FilteredValues[Index] = KeyValue;
+				const TArray<int64>& UniqueValues = RuleUniqueValues[r];
+				const int64 Rank = (Key / RuleStrides[r]) % FMath::Max(1, UniqueValues.Num());
+				Partition = Partition->GetPartition(UniqueValues[Rank], &Rules[r]);
 			}
 
-			Partition->Add(Index);
+			Leaves[i] = Partition;
+		}
+
+		// Prefix sum over (leaf, scope); counts are turned into write cursors in-place.
+		// Scopes are walked in order so each leaf ends up with ascending point indices.
+
+		TArray<int32> LeafSizes;
+		LeafSizes.Init(0, NumLeaves);
+
+		for (TMap<int64, int32>& KeyCounts : ScopedKeyCounts)
+		{
+			for (TPair<int64, int32>& Pair : KeyCounts)
+			{
+				int32& LeafSize = LeafSizes[KeyToLeaf[Pair.Key]];
+				const int32 Count = Pair.Value;
+				Pair.Value = LeafSize;
+				LeafSize += Count;
+			}
+		}
+
+		for (int i = 0; i < NumLeaves; i++) { Leaves[i]->Points.SetNumUninitialized(LeafSizes[i]); }
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, ScatterPartitionPoints)
+
+		ScatterPartitionPoints->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScatterPoints(Scope);
+			};
+
+		// Same item count & chunk size as key computation, scopes are guaranteed to match
+		ScatterPartitionPoints->StartSubLoops(PointKeys.Num(), GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
+	void FProcessor::ScatterPoints(const PCGExMT::FScope& Scope)
+	{
+		TMap<int64, int32>& Cursors = ScopedKeyCounts[Scope.LoopIndex];
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			const int64 Key = PointKeys[Index];
+			int32& Cursor = Cursors.FindChecked(Key);
+			Leaves[KeyToLeaf.FindChecked(Key)]->Points[Cursor++] = Index;
+		}
+	}
+
+	void FProcessor::BuildPartitionsSynchronous()
+	{
+		const int32 NumPoints = PointDataFacade->GetNum();
+		for (int i = 0; i < NumPoints; i++)
+		{
+			TSharedPtr<PCGExPartition::FKPartition> Partition = RootPartition;
+			for (PCGExPartition::FRule& Rule : Rules) { Partition = Partition->GetPartition(Rule.FilteredValues[i], &Rule); }
+			Partition->Points.Add(i);
 		}
 	}
 
@@ -288,6 +468,12 @@ namespace PCGExPartitionByValues
 	void FProcessor::CompleteWork()
 	{
 		IProcessor::CompleteWork();
+
+		PointKeys.Empty();
+		ScopedKeyCounts.Empty();
+		KeyToLeaf.Empty();
+		Leaves.Empty();
+
 		RootPartition->SortPartitions();
 
 		if (Settings->bSplitOutput)
@@ -125,6 +125,7 @@ namespace PCGExUberFilter
 
 		// Must be set before process for filters
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
+		bUsePointFilterBits = true;
 
 		if (!IProcessor::Process(InAsyncManager)) { return false; }
 
@@ -136,77 +137,41 @@ namespace PCGExUberFilter
 		{
 			Results = PointDataFacade->GetWritable<bool>(Settings->ResultAttributeName, false, true, PCGExData::EBufferInit::New);
 		}
-		else
-		{
-			PCGEx::InitArray(PointFilterCache, PointDataFacade->GetNum());
-		}
 
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
 	}
 
-	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
-	{
-		if (!Results)
-		{
-			const int32 MaxRange = PCGExMT::FScope::GetMaxRange(Loops);
-
-			IndicesInside = MakeShared<PCGExMT::TScopedArray<int32>>(Loops);
-			IndicesInside->Reserve(MaxRange);
-
-			IndicesOutside = MakeShared<PCGExMT::TScopedArray<int32>>(Loops);
-			IndicesOutside->Reserve(MaxRange);
-		}
-	}
-
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::UberFilter::ProcessPoints);
 
 		PointDataFacade->Fetch(Scope);
-		FilterScope(Scope);
+		int32 NumPass = FilterScope(Scope);
 
-		if (bUsePicks)
+		if (bUsePicks || Settings->bSwap)
 		{
+			TArray<int8> Selection;
+			Selection.SetNumUninitialized(Scope.Count);
+
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				if (!Picks.Contains(Index)) { PointFilterCache[Index] = Settings->UnpickedFallback == EPCGExFilterFallback::Pass; }
+				bool bPass = PointFilterBits->Get(Index);
+				if (bUsePicks && !Picks.Contains(Index)) { bPass = Settings->UnpickedFallback == EPCGExFilterFallback::Pass; }
+				Selection[Index - Scope.Start] = Settings->bSwap ? !bPass : bPass;
 			}
-		}
 
-		if (Settings->bSwap)
-		{
-			PCGEX_SCOPE_LOOP(Index) { PointFilterCache[Index] = !PointFilterCache[Index]; }
+			PointFilterBits->Set(Scope.Start, Scope.Count, Selection.GetData());
+			NumPass = PointFilterBits->CountRange(Scope.Start, Scope.End);
 		}
 
-		if (!Results)
-		{
-			TArray<int32>& IndicesInsideRef = IndicesInside->Get_Ref(Scope);
-			TArray<int32>& IndicesOutsideRef = IndicesOutside->Get_Ref(Scope);
-
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				const int8 bPass = PointFilterCache[Index];
-
-				if (bPass) { IndicesInsideRef.Add(Index); }
-				else { IndicesOutsideRef.Add(Index); }
+		FPlatformAtomics::InterlockedAdd(&NumInside, NumPass);
+		FPlatformAtomics::InterlockedAdd(&NumOutside, Scope.Count - NumPass);
 
-				if (bPass) { FPlatformAtomics::InterlockedAdd(&NumInside, 1); }
-				else { FPlatformAtomics::InterlockedAdd(&NumOutside, 1); }
-			}
-		}
-		else
+		if (Results)
 		{
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				const int8 bPass = PointFilterCache[Index];
-
-				if (bPass) { FPlatformAtomics::InterlockedAdd(&NumInside, 1); }
-				else { FPlatformAtomics::InterlockedAdd(&NumOutside, 1); }
-
-				Results->SetValue(Index, bPass ? true : false);
-			}
+			PCGEX_SCOPE_LOOP(Index) { Results->SetValue(Index, PointFilterBits->Get(Index)); }
 		}
 	}
 
@@ -256,12 +221,12 @@ namespace PCGExUberFilter
 			return;
 		}
 
-		const int32 NumPoints = PointDataFacade->GetNum();
-		TArray<int32> Indices;
-		PCGEx::InitArray(Indices, NumPoints);
+		// Selection is read back from the filter bits, word by word
+		const PCGExMT::FScope AllPoints = PCGExMT::FScope(0, PointDataFacade->GetNum());
 
 		TArray<int32> ReadIndices;
-		IndicesInside->Collapse(ReadIndices);
+		ReadIndices.Reserve(FMath::Max(NumInside, NumOutside));
+		GatherFilteredIndices(AllPoints, ReadIndices, true);
 
 		Inside = CreateIO(Context->Inside.ToSharedRef(), PCGExData::EIOInit::New);
 		if (!Inside) { return; }
@@ -274,7 +239,7 @@ namespace PCGExUberFilter
 		if (!Settings->bOutputDiscardedElements) { return; }
 
 		ReadIndices.Reset();
-		IndicesOutside->Collapse(ReadIndices);
+		GatherFilteredIndices(AllPoints, ReadIndices, false);
 		Outside = CreateIO(Context->Outside.ToSharedRef(), PCGExData::EIOInit::New);
 
 		if (!Outside) { return; }
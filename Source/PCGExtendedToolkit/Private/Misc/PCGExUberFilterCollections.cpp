@@ -169,7 +169,7 @@ namespace PCGExUberFilterCollections
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::UberFilterCollections::ProcessPoints);
 
 		PointDataFacade->Fetch(Scope);
-		FilterScope(Scope);
+		const int32 NumPass = FilterScope(Scope);
 
 		if (bUsePicks)
 		{
@@ -182,11 +182,8 @@ namespace PCGExUberFilterCollections
 		}
 		else
 		{
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				if (PointFilterCache[Index]) { FPlatformAtomics::InterlockedAdd(&NumInside, 1); }
-				else { FPlatformAtomics::InterlockedAdd(&NumOutside, 1); }
-			}
+			FPlatformAtomics::InterlockedAdd(&NumInside, NumPass);
+			FPlatformAtomics::InterlockedAdd(&NumOutside, Scope.Count - NumPass);
 		}
 	}
 
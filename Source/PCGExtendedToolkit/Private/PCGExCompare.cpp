@@ -170,6 +170,30 @@ namespace PCGExCompare
 		}
 	}
 
+	void CompareScope(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, const TArrayView<int8> InOutMask, const bool bInvert)
+	{
+		check(Flags.Num() == Masks.Num() && Flags.Num() == InOutMask.Num())
+
+		const int32 Num = Flags.Num();
+		const int8 Invert = bInvert ? 1 : 0;
+
+#define PCGEX_BITFLAG_SCOPE(_METHOD, _TEST) case EPCGExBitflagComparison::_METHOD: for (int i = 0; i < Num; i++) { InOutMask[i] &= static_cast<int8>(_TEST) ^ Invert; } break;
+
+		switch (Method)
+		{
+		PCGEX_BITFLAG_SCOPE(MatchPartial, (Flags[i] & Masks[i]) != 0)
+		PCGEX_BITFLAG_SCOPE(MatchFull, (Flags[i] & Masks[i]) == Masks[i])
+		PCGEX_BITFLAG_SCOPE(MatchStrict, Flags[i] == Masks[i])
+		PCGEX_BITFLAG_SCOPE(NoMatchPartial, (Flags[i] & Masks[i]) == 0)
+		PCGEX_BITFLAG_SCOPE(NoMatchFull, (Flags[i] & Masks[i]) != Masks[i])
+		default:
+			if (!bInvert) { FMemory::Memzero(InOutMask.GetData(), Num * sizeof(int8)); }
+			break;
+		}
+
+#undef PCGEX_BITFLAG_SCOPE
+	}
+
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict)
 	{
 		if (bStrict)
@@ -334,6 +358,38 @@ bool FPCGExDotComparisonDetails::Test(const double A, const int32 Index) const
 	return Test(A, GetComparisonThreshold(Index));
 }
 
+void FPCGExDotComparisonDetails::TestScope(const int32 Start, const TConstArrayView<double> Dots, const TArrayView<int8> InOutMask) const
+{
+	const int32 Num = Dots.Num();
+
+	TArray<double> A;
+	TArray<double> B;
+	A.SetNumUninitialized(Num);
+	B.SetNumUninitialized(Num);
+
+	ThresholdGetter->ReadScope(Start, B);
+	if (Domain == EPCGExAngularDomain::Degrees) { for (double& Threshold : B) { Threshold = PCGExMath::DegreesToDot(180 - Threshold); } }
+
+	if (bUnsignedComparison)
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			A[i] = FMath::Abs(Dots[i]);
+			B[i] = FMath::Abs(B[i]);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			A[i] = (1 + Dots[i]) * 0.5;
+			B[i] = (1 + B[i]) * 0.5;
+		}
+	}
+
+	PCGExCompare::CompareScope<double>(Comparison, A, B, InOutMask, ComparisonTolerance);
+}
+
 void FPCGExDotComparisonDetails::RegisterConsumableAttributesWithData(FPCGExContext* InContext, const UPCGData* InData) const
 {
 	FName Consumable = NAME_None;
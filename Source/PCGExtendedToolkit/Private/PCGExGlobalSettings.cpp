@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGPin.h"
+#include "Graph/Data/PCGExClusterData.h"
 
 // Define static members
 TArray<PCGEx::FPinInfos> UPCGExGlobalSettings::InPinInfos;
@@ -13,6 +14,11 @@ TMap<FName, int32> UPCGExGlobalSettings::InPinInfosMap;
 TMap<FName, int32> UPCGExGlobalSettings::OutPinInfosMap;
 bool UPCGExGlobalSettings::bGeneratedPinMap = false; // Initialize to a default value
 
+void UPCGExGlobalSettings::ClearPersistentClusterCache()
+{
+	PCGExClusterData::ClearPersistentCache();
+}
+
 FLinearColor UPCGExGlobalSettings::WantsColor(const FLinearColor InColor) const
 {
 	return bUseNativeColorsIfPossible ? FLinearColor::White : InColor;
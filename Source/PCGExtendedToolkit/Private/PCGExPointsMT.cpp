@@ -151,7 +151,8 @@ namespace PCGExPointsMT
 
 	bool IProcessor::InitPrimaryFilters(const TArray<TObjectPtr<const UPCGExFilterFactoryData>>* InFilterFactories)
 	{
-		PointFilterCache.Init(DefaultPointFilterValue, PointDataFacade->GetNum());
+		if (bUsePointFilterBits) { PointFilterBits = MakeShared<PCGExMT::FAtomicBitArray>(PointDataFacade->GetNum(), DefaultPointFilterValue); }
+		else { PointFilterCache.Init(DefaultPointFilterValue, PointDataFacade->GetNum()); }
 
 		if (InFilterFactories->IsEmpty()) { return true; }
 
@@ -161,7 +162,18 @@ namespace PCGExPointsMT
 
 	int32 IProcessor::FilterScope(const PCGExMT::FScope& Scope)
 	{
-		if (PrimaryFilters) { return PrimaryFilters->Test(Scope, PointFilterCache); }
+		if (PrimaryFilters)
+		{
+			if (!PointFilterBits) { return PrimaryFilters->Test(Scope, PointFilterCache); }
+
+			TArray<int8> Mask;
+			Mask.Init(1, Scope.Count);
+
+			const int32 NumPass = PrimaryFilters->TestScope(Scope, Mask);
+			PointFilterBits->Set(Scope.Start, Scope.Count, Mask.GetData());
+			return NumPass;
+		}
+
 		return DefaultPointFilterValue ? Scope.Count : 0;
 	}
 
@@ -170,6 +182,22 @@ namespace PCGExPointsMT
 		return FilterScope(PCGExMT::FScope(0, PointDataFacade->GetNum()));
 	}
 
+	int32 IProcessor::GatherFilteredIndices(const PCGExMT::FScope& Scope, TArray<int32>& OutIndices, const bool bPass) const
+	{
+		const int32 NumBefore = OutIndices.Num();
+
+		if (PointFilterBits)
+		{
+			PointFilterBits->ForEach(Scope.Start, Scope.End, bPass, [&](const int32 Index) { OutIndices.Add(Index); });
+		}
+		else
+		{
+			PCGEX_SCOPE_LOOP(Index) { if (static_cast<bool>(PointFilterCache[Index]) == bPass) { OutIndices.Add(Index); } }
+		}
+
+		return OutIndices.Num() - NumBefore;
+	}
+
 	IBatch::IBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
 		: ExecutionContext(InContext), PointsCollection(InPointsCollection)
 	{
@@ -127,6 +127,12 @@ namespace PCGExBlendPath
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
+		// Gather the whole scope first so each blend op runs as a single typed loop
+		TArray<int32, TInlineAllocator<256>> Targets;
+		TArray<double, TInlineAllocator<256>> Alphas;
+		Targets.Reserve(Scope.Count);
+		Alphas.Reserve(Scope.Count);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if ((Index == 0 && !Settings->bBlendFirstPoint) ||
@@ -150,8 +156,18 @@ namespace PCGExBlendPath
 				Alpha = LerpGetter->Read(Index);
 			}
 
-			BlendOpsManager->Blend(Start, End, Index, Alpha);
+			Targets.Add(Index);
+			Alphas.Add(Alpha);
 		}
+
+		if (Targets.IsEmpty()) { return; }
+
+		TArray<int32, TInlineAllocator<256>> Starts;
+		TArray<int32, TInlineAllocator<256>> Ends;
+		Starts.Init(Start, Targets.Num());
+		Ends.Init(End, Targets.Num());
+
+		BlendOpsManager->BlendRange(Starts, Ends, Targets, Alphas);
 	}
 
 	void FProcessor::CompleteWork()
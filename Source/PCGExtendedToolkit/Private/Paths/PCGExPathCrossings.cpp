@@ -65,7 +65,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 
 		const bool bIsCanBeCutTagValid = PCGEx::IsValidStringTag(Context->CanBeCutTag);
 
-		if (!Context->StartBatchProcessingPoints<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>(
+		if (!Context->StartBatchProcessingPoints<PCGExPathCrossings::FBatch>(
 			[&](const TSharedPtr<PCGExData::FPointIO>& Entry)
 			{
 				if (Entry->GetNum() < 2)
@@ -80,7 +80,7 @@ bool FPCGExPathCrossingsElement::ExecuteInternal(FPCGContext* InContext) const
 				}
 				return true;
 			},
-			[&](const TSharedPtr<PCGExPointsMT::TBatch<PCGExPathCrossings::FProcessor>>& NewBatch)
+			[&](const TSharedPtr<PCGExPathCrossings::FBatch>& NewBatch)
 			{
 				//NewBatch->SetPointsFilterData(&Context->FilterFactories);
 				NewBatch->bRequiresWriteStep = Settings->bDoCrossBlending;
@@ -164,7 +164,16 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+		if (bCanCut)
+		{
+			if (bSelfIntersectionOnly) { Path->BuildPartialEdgeOctree(CanCut); }
+			else
+			{
+				// Collected here so the gather runs in parallel across processors; the context builds the shared BVH
+				CutterEdges.Reserve(Path->NumEdges);
+				for (int i = 0; i < Path->NumEdges; i++) { if (CanCut[i] && Path->IsEdgeValid(Path->Edges[i])) { CutterEdges.Add(i); } }
+			}
+		}
 
 		CanCut.Empty();
 
@@ -181,31 +190,23 @@ namespace PCGExPathCrossings
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
-		if (!Parent) { return; }
-
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+		const PCGExGeo::FSegmentBVH* CutterBVH = nullptr;
 
 		if (bSelfIntersectionOnly)
 		{
-			if (bCanCut && Path->GetEdgeOctree()) { Cutters.Add(Path); }
+			if (!bCanCut || !Path->GetEdgeOctree()) { return; }
 		}
 		else
 		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
-
-			for (const TSharedRef<FProcessor>& OtherProcessor : TypedParent->Processors)
-			{
-				if (!Details.bEnableSelfIntersection && &OtherProcessor.Get() == this) { continue; }
-				if (!OtherProcessor->bCanCut || !OtherProcessor->Path->GetEdgeOctree()) { continue; }
-
-				Cutters.Add(OtherProcessor->Path);
-			}
+			CutterBVH = Context->CutterBVH.Get();
+			if (!CutterBVH) { return; }
 		}
 
-		if (Cutters.IsEmpty()) { return; }
+		// BVH segments are not expanded, so pad the query by the edge expansion to match edge-vs-edge bounds overlap
+		const double Padding = Details.Tolerance * 2;
+
+		// Scope-local candidate buffer, sorted so crossings are found in the same order regardless of BVH layout
+		TArray<int32> Candidates;
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -216,16 +217,39 @@ namespace PCGExPathCrossings
 			const PCGExPaths::FPathEdge& Edge = Path->Edges[Index];
 			if (!Path->IsEdgeValid(Edge)) { continue; }
 
+			if (CutterBVH)
+			{
+				Candidates.Reset();
+				CutterBVH->ForEachInBox(
+					Edge.Bounds.GetBox().ExpandBy(Padding),
+					[&](const int32 SegmentIndex, const FVector&, const FVector&) { Candidates.Add(SegmentIndex); });
+
+				if (Candidates.IsEmpty()) { continue; }
+
+				Candidates.Sort();
+			}
+
 			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
 
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			if (CutterBVH)
+			{
+				for (const int32 SegmentIndex : Candidates)
+				{
+					uint32 PathIndex;
+					uint32 EdgeIndex;
+					PCGEx::H64(Context->CutterEdges[SegmentIndex], PathIndex, EdgeIndex);
+
+					const TSharedPtr<PCGExPaths::FPath>& OtherPath = Context->CutterPaths[PathIndex];
+					if (!Details.bEnableSelfIntersection && OtherPath == Path) { continue; }
+
+					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[EdgeIndex], Details);
+				}
+			}
+			else
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(
+				Path->GetEdgeOctree()->FindElementsWithBoundsTest(
 					Edge.Bounds.GetBox(),
-					[&](const PCGExPaths::FPathEdge* OtherEdge)
-					{
-						NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
-					});
+					[&](const PCGExPaths::FPathEdge* OtherEdge) { NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details); });
 			}
 
 			if (!NewCrossing->IsEmpty())
@@ -489,6 +513,112 @@ namespace PCGExPathCrossings
 
 		CrossBlendTask->StartSubLoops(Path->NumEdges, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
 	}
+
+	FBatch::FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+		: TBatch(InContext, InPointsCollection)
+	{
+	}
+
+	void FBatch::OnInitialPostProcess()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		TBatch<FProcessor>::OnInitialPostProcess();
+
+		if (Settings->bSelfIntersectionOnly) { return; }
+
+		// Every processor gathered its cutting edges during Process; stitch them into a single BVH
+		// so each edge only visits nearby segments instead of every other path's octree.
+		// The build is kicked off from here so it runs on workers, and the batch won't complete until it's done.
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, GatherCutterEdges)
+
+		GatherCutterEdges->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->BuildCutterSubtrees();
+			};
+
+		GatherCutterEdges->AddSimpleCallback(
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->GatherCutters();
+			});
+
+		GatherCutterEdges->StartSimpleCallbacks();
+	}
+
+	void FBatch::GatherCutters()
+	{
+		FPCGExPathCrossingsContext* Context = GetContext<FPCGExPathCrossingsContext>();
+
+		int32 NumSegments = 0;
+		for (const TSharedRef<FProcessor>& P : Processors)
+		{
+			if (!P->GetCanCut() || P->GetCutterEdges().IsEmpty()) { continue; }
+			NumSegments += P->GetCutterEdges().Num();
+		}
+
+		if (NumSegments == 0) { return; }
+
+		Context->CutterPaths.Reserve(Processors.Num());
+		Context->CutterEdges.Reserve(NumSegments);
+
+		for (const TSharedRef<FProcessor>& P : Processors)
+		{
+			if (!P->GetCanCut() || P->GetCutterEdges().IsEmpty()) { continue; }
+
+			const int32 PathIndex = Context->CutterPaths.Add(P->GetPath());
+			for (const int32 EdgeIndex : P->GetCutterEdges()) { Context->CutterEdges.Add(PCGEx::H64(PathIndex, EdgeIndex)); }
+		}
+
+		Context->CutterBVH = MakeShared<PCGExGeo::FSegmentBVH>();
+		NumCutterSubtrees = Context->CutterBVH->BeginBuild(
+			NumSegments, [&](const int32 Index, FVector& OutStart, FVector& OutEnd)
+			{
+				uint32 PathIndex;
+				uint32 EdgeIndex;
+				PCGEx::H64(Context->CutterEdges[Index], PathIndex, EdgeIndex);
+
+				const TSharedPtr<PCGExPaths::FPath>& CutterPath = Context->CutterPaths[PathIndex];
+				const PCGExPaths::FPathEdge& Edge = CutterPath->Edges[EdgeIndex];
+				OutStart = CutterPath->GetPos_Unsafe(Edge.Start);
+				OutEnd = CutterPath->GetPos_Unsafe(Edge.End);
+			});
+	}
+
+	void FBatch::BuildCutterSubtrees()
+	{
+		const FPCGExPathCrossingsContext* Context = GetContext<FPCGExPathCrossingsContext>();
+
+		if (!Context->CutterBVH) { return; }
+
+		if (NumCutterSubtrees == 0)
+		{
+			Context->CutterBVH->EndBuild();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, BuildCutterBVH)
+
+		BuildCutterBVH->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->GetContext<FPCGExPathCrossingsContext>()->CutterBVH->EndBuild();
+			};
+
+		BuildCutterBVH->OnIterationCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->GetContext<FPCGExPathCrossingsContext>()->CutterBVH->BuildSubtree(Index);
+			};
+
+		BuildCutterBVH->StartIterations(NumCutterSubtrees, 1);
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -3,6 +3,8 @@
 
 #include "Paths/PCGExResamplePath.h"
 
+#include "Algo/BinarySearch.h"
+
 #define LOCTEXT_NAMESPACE "PCGExResamplePathElement"
 #define PCGEX_NAMESPACE ResamplePath
 
@@ -66,108 +68,118 @@ namespace PCGExResamplePath
 
 		Path = PCGExPaths::MakePath(InPoints, 0);
 		Path->IOIndex = PointDataFacade->Source->IOIndex;
-		PathLength = Path->AddExtra<PCGExPaths::FPathEdgeLength>(true); // Force compute length
 
-		if (Settings->Mode == EPCGExResampleMode::Sweep)
-		{
-			if (Settings->ResolutionMode == EPCGExResolutionMode::Fixed)
+		// Cumulative arc length as a blocked parallel prefix sum :
+		// each scope scans its own edges, scope offsets are scanned once they're all done, then added back in parallel.
+		CumulativeLength.SetNumUninitialized(Path->NumEdges);
+
+		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, ArcLengthTask)
+
+		ArcLengthTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
-				NumSamples = Settings->Resolution;
-			}
-			else
+				PCGEX_ASYNC_THIS
+				This->OffsetArcLength();
+			};
+
+		ArcLengthTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
 			{
-				NumSamples = PCGEx::TruncateDbl(PathLength->TotalLength / Settings->Resolution, Settings->Truncate);
-			}
+				PCGEX_ASYNC_THIS
+				This->ScopeLengths.SetNumUninitialized(Loops.Num());
+			};
 
-			if (Path->IsClosedLoop()) { NumSamples++; }
+		ArcLengthTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScanArcLength(Scope);
+			};
 
-			if (NumSamples < 2) { return false; }
+		ArcLengthTask->StartSubLoops(Path->NumEdges, ArcLengthChunkSize);
 
-			PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::New)
-			PCGEx::SetNumPointsAllocated(PointDataFacade->GetOut(), NumSamples, PointDataFacade->GetAllocations());
+		return true;
+	}
+
+	void FProcessor::ScanArcLength(const PCGExMT::FScope& Scope)
+	{
+		double Sum = 0;
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const PCGExPaths::FPathEdge& Edge = Path->Edges[i];
+			Sum += FVector::Dist(Path->GetPos_Unsafe(Edge.Start), Path->GetPos_Unsafe(Edge.End));
+			CumulativeLength[i] = Sum;
 		}
-		else
+
+		ScopeLengths[Scope.LoopIndex] = Sum;
+	}
+
+	void FProcessor::OffsetArcLength()
+	{
+		double Offset = 0;
+		for (double& ScopeLength : ScopeLengths)
 		{
-			PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
-			PointDataFacade->GetOut()->AllocateProperties(EPCGPointNativeProperties::Transform);
-			NumSamples = PointDataFacade->GetNum();
+			const double Length = ScopeLength;
+			ScopeLength = Offset;
+			Offset += Length;
 		}
 
-		SampleLength = PathLength->TotalLength / static_cast<double>(NumSamples - 1);
+		TotalLength = Offset;
 
-		Samples.SetNumUninitialized(NumSamples);
-		bDaisyChainProcessPoints = true;
+		if (ScopeLengths.Num() < 2) { return; }
 
-		TConstPCGValueRange<FTransform> InTransforms = PointDataFacade->GetIn()->GetConstTransformValueRange();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, OffsetArcLengthTask)
 
-		int32 StartIndex = 0;
-		int32 EndIndex = 1;
-		FVector PrevPosition = InTransforms[0].GetLocation();
-		double TraversedDistance = 0;
+		OffsetArcLengthTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
 
-		FPointSample& FirstSample = Samples[0];
-		FirstSample.Start = StartIndex;
-		FirstSample.End = EndIndex;
-		FirstSample.Location = PrevPosition;
-		FirstSample.Distance = TraversedDistance;
+				// Same chunking as the scan, so scopes line up with their offsets
+				const double ScopeOffset = This->ScopeLengths[Scope.LoopIndex];
+				if (ScopeOffset == 0) { return; }
 
-		for (int i = 1; i < NumSamples; i++)
-		{
-			FPointSample& Sample = Samples[i];
-			Sample.Start = StartIndex;
+				PCGEX_SCOPE_LOOP(i) { This->CumulativeLength[i] += ScopeOffset; }
+			};
+
+		OffsetArcLengthTask->StartSubLoops(Path->NumEdges, ArcLengthChunkSize);
+	}
 
-			FVector NextPosition = InTransforms[EndIndex].GetLocation();
-			double DistToNext = FVector::Dist(PrevPosition, NextPosition);
-			double Remainder = SampleLength - DistToNext;
+	void FProcessor::CompleteWork()
+	{
+		ScopeLengths.Empty();
 
-			if (Remainder <= 0)
+		if (Settings->Mode == EPCGExResampleMode::Sweep)
+		{
+			if (Settings->ResolutionMode == EPCGExResolutionMode::Fixed)
 			{
-				// Overshooting
-				PrevPosition = PrevPosition + (Path->DirToNextPoint(StartIndex) * SampleLength);
-				TraversedDistance += SampleLength;
+				NumSamples = Settings->Resolution;
 			}
 			else
 			{
-				PrevPosition = NextPosition;
-
-				while (Remainder > 0)
-				{
-					StartIndex = EndIndex++;
-
-					if (EndIndex >= InTransforms.Num())
-					{
-						if (!Path->IsClosedLoop())
-						{
-							EndIndex = InTransforms.Num() - 1;
-							break;
-						}
-
-						EndIndex = 0;
-					}
+				NumSamples = PCGEx::TruncateDbl(TotalLength / Settings->Resolution, Settings->Truncate);
+			}
 
-					NextPosition = InTransforms[EndIndex].GetLocation();
-					DistToNext = FVector::Dist(PrevPosition, NextPosition);
+			if (Path->IsClosedLoop()) { NumSamples++; }
 
-					if (Remainder <= DistToNext) { PrevPosition = PrevPosition + (Path->DirToPrevPoint(EndIndex) * -Remainder); }
-					else { PrevPosition = NextPosition; }
-					Remainder -= DistToNext;
-				}
+			if (NumSamples < 2)
+			{
+				bIsProcessorValid = false;
+				return;
 			}
 
-			Sample.End = EndIndex;
-			Sample.Location = PrevPosition;
-			Sample.Distance = TraversedDistance;
+			PCGEX_INIT_IO_VOID(PointDataFacade->Source, PCGExData::EIOInit::New)
+			PCGEx::SetNumPointsAllocated(PointDataFacade->GetOut(), NumSamples, PointDataFacade->GetAllocations());
 		}
-
-		if (Settings->bPreserveLastPoint && !Path->IsClosedLoop())
+		else
 		{
-			FPointSample& LastSample = Samples.Last();
-			LastSample.Start = InTransforms.Num() - 2;
-			LastSample.End = InTransforms.Num() - 1;
-			LastSample.Location = InTransforms[LastSample.End].GetLocation();
-			LastSample.Distance = TraversedDistance;
+			PCGEX_INIT_IO_VOID(PointDataFacade->Source, PCGExData::EIOInit::Duplicate)
+			PointDataFacade->GetOut()->AllocateProperties(EPCGPointNativeProperties::Transform);
+			NumSamples = PointDataFacade->GetNum();
 		}
 
+		SampleLength = TotalLength / static_cast<double>(NumSamples - 1);
+
 		if (Settings->Mode == EPCGExResampleMode::Sweep)
 		{
 			// Blender will take care of setting all the properties and stuff			
@@ -176,13 +188,39 @@ namespace PCGExResamplePath
 			MetadataBlender->SetTargetData(PointDataFacade);
 			if (!MetadataBlender->Init(Context, Settings->BlendingSettings, nullptr, false, PCGExData::EIOSide::In))
 			{
-				return false;
+				bIsProcessorValid = false;
+				return;
 			}
 		}
 
 		StartParallelLoopForPoints();
+	}
 
-		return true;
+	void FProcessor::GetSample(const int32 Index, FPointSample& OutSample) const
+	{
+		if (Index == NumSamples - 1 && Settings->bPreserveLastPoint && !Path->IsClosedLoop())
+		{
+			OutSample.Start = Path->NumPoints - 2;
+			OutSample.End = Path->LastIndex;
+			OutSample.Location = Path->GetPos_Unsafe(OutSample.End);
+			OutSample.Distance = TotalLength;
+			return;
+		}
+
+		const double Distance = FMath::Min(Index * SampleLength, TotalLength);
+
+		// First edge whose end reaches the sample distance
+		const int32 EdgeIndex = FMath::Min(Algo::LowerBound(CumulativeLength, Distance), Path->NumEdges - 1);
+		const PCGExPaths::FPathEdge& Edge = Path->Edges[EdgeIndex];
+
+		const double EdgeStartDistance = EdgeIndex == 0 ? 0 : CumulativeLength[EdgeIndex - 1];
+		const double EdgeLength = CumulativeLength[EdgeIndex] - EdgeStartDistance;
+		const double Alpha = EdgeLength > 0 ? FMath::Clamp((Distance - EdgeStartDistance) / EdgeLength, 0.0, 1.0) : 0;
+
+		OutSample.Start = Edge.Start;
+		OutSample.End = Edge.End;
+		OutSample.Location = FMath::Lerp(Path->GetPos_Unsafe(Edge.Start), Path->GetPos_Unsafe(Edge.End), Alpha);
+		OutSample.Distance = Distance;
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
@@ -195,9 +233,10 @@ namespace PCGExResamplePath
 
 		if (Settings->Mode == EPCGExResampleMode::Redistribute)
 		{
+			FPointSample Sample;
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				const FPointSample& Sample = Samples[Index];
+				GetSample(Index, Sample);
 				OutTransforms[Index].SetLocation(Sample.Location);
 			}
 		}
@@ -206,9 +245,10 @@ namespace PCGExResamplePath
 			TArray<PCGEx::FOpStats> Trackers;
 			MetadataBlender->InitTrackers(Trackers);
 
+			FPointSample Sample;
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				const FPointSample& Sample = Samples[Index];
+				GetSample(Index, Sample);
 				OutTransforms[Index].SetLocation(Sample.Location);
 
 				//if (SourcesRange == 1)
@@ -220,8 +260,8 @@ namespace PCGExResamplePath
 
 				/*
 				// TODO : Complex blending
-				const double MinLength = Sample.Start == 0 ? 0 : PathLength->CumulativeLength[Sample.Start - 1];
-				const double MaxLength = PathLength->CumulativeLength[Path->IsValidEdgeIndex(Sample.End) ? PathLength->TotalLength : Sample.End - 1];
+				const double MinLength = Sample.Start == 0 ? 0 : CumulativeLength[Sample.Start - 1];
+				const double MaxLength = CumulativeLength[Path->IsValidEdgeIndex(Sample.End) ? TotalLength : Sample.End - 1];
 				const double Range = MaxLength - MinLength;
 				
 				for (int i = 0; i < SourcesRange; i++)
@@ -240,7 +280,7 @@ namespace PCGExResamplePath
 		}
 	}
 
-	void FProcessor::CompleteWork()
+	void FProcessor::OnPointsProcessingComplete()
 	{
 		PointDataFacade->WriteFastest(AsyncManager);
 	}
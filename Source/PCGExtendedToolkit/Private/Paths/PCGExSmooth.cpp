@@ -130,6 +130,9 @@ namespace PCGExSmooth
 		SmoothingOperation->Path = PointDataFacade->Source;
 		SmoothingOperation->Blender = DataBlender;
 		SmoothingOperation->bClosedLoop = bClosedLoop;
+		SmoothingOperation->PrepareForData(
+			Settings->SmoothingAmountType == EPCGExInputValueType::Constant ?
+				FMath::Max(0.0, Settings->SmoothingAmountConstant) * Settings->ScaleSmoothingAmountAttribute : -1);
 
 		StartParallelLoopForPoints();
 
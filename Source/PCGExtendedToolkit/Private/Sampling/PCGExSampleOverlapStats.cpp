@@ -7,25 +7,43 @@
 #define LOCTEXT_NAMESPACE "PCGExSampleOverlapStatsElement"
 #define PCGEX_NAMESPACE SampleOverlapStats
 
-TSharedPtr<PCGExSampleOverlapStats::FOverlap> FPCGExSampleOverlapStatsContext::RegisterOverlap(
-	PCGExSampleOverlapStats::FProcessor* InA,
-	PCGExSampleOverlapStats::FProcessor* InB,
-	const FBox& InIntersection)
+void FPCGExSampleOverlapStatsContext::BatchProcessing_InitialProcessingDone()
 {
-	const uint64 HashID = PCGEx::H64U(InA->BatchIndex, InB->BatchIndex);
+	FPCGExPointsProcessorContext::BatchProcessing_InitialProcessingDone();
 
+	// All data bounds are known at this point; find overlapping pairs once and hand them to both processors.
+
+	const TSharedPtr<PCGExPointsMT::TBatch<PCGExSampleOverlapStats::FProcessor>> TypedBatch = StaticCastSharedPtr<PCGExPointsMT::TBatch<PCGExSampleOverlapStats::FProcessor>>(MainBatch);
+
+	TArray<PCGExSampleOverlapStats::FProcessor*> Candidates;
+	TArray<FBox> CandidateBounds;
+
+	Candidates.Reserve(TypedBatch->Processors.Num());
+	CandidateBounds.Reserve(TypedBatch->Processors.Num());
+
+	for (const TSharedRef<PCGExSampleOverlapStats::FProcessor>& P : TypedBatch->Processors)
 	{
-		FReadScopeLock ReadScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExSampleOverlapStats::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
+		if (!P->bIsProcessorValid) { continue; }
+		Candidates.Add(&P.Get());
+		CandidateBounds.Add(P->GetBounds());
 	}
 
+	TArray<PCGExDiscardByOverlap::FBoundsPair> Pairs;
+	PCGExDiscardByOverlap::SweepAndPrune(CandidateBounds, Pairs);
+
+	OverlapMap.Reserve(Pairs.Num());
+
+	for (const PCGExDiscardByOverlap::FBoundsPair& Pair : Pairs)
 	{
-		FWriteScopeLock WriteScopeLock(OverlapLock);
-		if (TSharedPtr<PCGExSampleOverlapStats::FOverlap>* FoundPtr = OverlapMap.Find(HashID)) { return *FoundPtr; }
+		PCGExSampleOverlapStats::FProcessor* Primary = Candidates[Pair.A];
+		PCGExSampleOverlapStats::FProcessor* Secondary = Candidates[Pair.B];
+
+		PCGEX_MAKE_SHARED(NewOverlap, PCGExSampleOverlapStats::FOverlap, Primary, Secondary, Pair.Intersection)
+		OverlapMap.Add(NewOverlap->HashID, NewOverlap);
 
-		PCGEX_MAKE_SHARED(NewOverlap, PCGExSampleOverlapStats::FOverlap, InA, InB, InIntersection)
-		OverlapMap.Add(HashID, NewOverlap);
-		return NewOverlap;
+		Primary->Overlaps.Add(NewOverlap.ToSharedRef());
+		Primary->ManagedOverlaps.Add(NewOverlap.ToSharedRef());
+		Secondary->Overlaps.Add(NewOverlap.ToSharedRef());
 	}
 }
 
@@ -100,14 +118,6 @@ namespace PCGExSampleOverlapStats
 	{
 	}
 
-	void FProcessor::RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection)
-	{
-		FWriteScopeLock WriteScopeLock(RegistrationLock);
-		const TSharedPtr<FOverlap> Overlap = Context->RegisterOverlap(this, InOtherProcessor, Intersection);
-		if (Overlap->Primary == this) { ManagedOverlaps.Add(Overlap.ToSharedRef()); }
-		Overlaps.Add(Overlap.ToSharedRef());
-	}
-
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
 	{
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
@@ -133,11 +143,21 @@ namespace PCGExSampleOverlapStats
 
 		PCGEX_ASYNC_GROUP_CHKD(AsyncManager, BoundsPreparationTask)
 
+		BoundsPreparationTask->OnPrepareSubLoopsCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
+			{
+				PCGEX_ASYNC_THIS
+				This->ScopedBounds = MakeShared<PCGExMT::TScopedValue<FBox>>(Loops, FBox(ForceInit));
+			};
+
 		BoundsPreparationTask->OnCompleteCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
 
+				This->Bounds = This->ScopedBounds->Flatten([](const FBox& A, const FBox& B) { return A + B; });
+				This->ScopedBounds.Reset();
+
 				This->Octree = MakeUnique<PCGExDiscardByOverlap::FPointBoundsOctree>(This->Bounds.GetCenter(), This->Bounds.GetExtent().Length());
 				for (const TSharedPtr<PCGExDiscardByOverlap::FPointBounds>& PtBounds : This->LocalPointBounds)
 				{
@@ -165,7 +185,7 @@ namespace PCGExSampleOverlapStats
 
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::ScaledBounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<PCGExDiscardByOverlap::FPointBounds> PtBounds = MakeShared<PCGExDiscardByOverlap::FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				}
 				else if (This->Settings->BoundsSource == EPCGExPointBoundsSource::DensityBounds)
@@ -176,7 +196,7 @@ namespace PCGExSampleOverlapStats
 
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::DensityBounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<PCGExDiscardByOverlap::FPointBounds> PtBounds = MakeShared<PCGExDiscardByOverlap::FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				}
 				else if (This->Settings->BoundsSource == EPCGExPointBoundsSource::Bounds)
@@ -186,7 +206,7 @@ namespace PCGExSampleOverlapStats
 						PCGEX_POINT_CHECK
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::Bounds>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<PCGExDiscardByOverlap::FPointBounds> PtBounds = MakeShared<PCGExDiscardByOverlap::FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				}
 				else if (This->Settings->BoundsSource == EPCGExPointBoundsSource::Center)
@@ -196,7 +216,7 @@ namespace PCGExSampleOverlapStats
 						PCGEX_POINT_CHECK
 						const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::Center>(Point).ExpandBy(This->Settings->Expansion);
 						TSharedPtr<PCGExDiscardByOverlap::FPointBounds> PtBounds = MakeShared<PCGExDiscardByOverlap::FPointBounds>(i, Point, LocalBounds);
-						This->RegisterPointBounds(i, PtBounds);
+						This->RegisterPointBounds(Scope, i, PtBounds);
 					}
 				}
 			};
@@ -306,58 +326,33 @@ namespace PCGExSampleOverlapStats
 
 	void FProcessor::CompleteWork()
 	{
-		// 2 - Find overlaps between large bounds, we'll be searching only there.
+		// 2 - Overlaps between data bounds have been found by the context broad phase, we'll be searching only there.
 
-		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, PreparationTask)
-		PreparationTask->OnCompleteCallback =
-			[PCGEX_ASYNC_THIS_CAPTURE]()
+		auto WrapUp = [PCGEX_ASYNC_THIS_CAPTURE]()
+		{
+			PCGEX_ASYNC_THIS
+			for (int i = 0; i < This->NumPoints; i++)
 			{
-				PCGEX_ASYNC_THIS
-				auto WrapUp = [AsyncThis]()
-				{
-					PCGEX_ASYNC_NESTED_THIS
-					for (int i = 0; i < NestedThis->NumPoints; i++)
-					{
-						NestedThis->LocalOverlapSubCountMax = FMath::Max(NestedThis->LocalOverlapSubCountMax, NestedThis->OverlapSubCount[i]);
-						NestedThis->LocalOverlapCountMax = FMath::Max(NestedThis->LocalOverlapCountMax, NestedThis->OverlapCount[i]);
-					}
-				};
+				This->LocalOverlapSubCountMax = FMath::Max(This->LocalOverlapSubCountMax, This->OverlapSubCount[i]);
+				This->LocalOverlapCountMax = FMath::Max(This->LocalOverlapCountMax, This->OverlapCount[i]);
+			}
+		};
 
-				if (This->Overlaps.IsEmpty())
-				{
-					WrapUp();
-					return;
-				}
-
-				PCGEX_ASYNC_GROUP_CHKD_VOID(This->AsyncManager, SearchTask)
-				SearchTask->OnCompleteCallback = WrapUp;
-				SearchTask->OnSubLoopStartCallback = [AsyncThis](const PCGExMT::FScope& Scope)
-				{
-					PCGEX_ASYNC_NESTED_THIS
-					PCGEX_SCOPE_LOOP(i) { NestedThis->ResolveOverlap(i); }
-				};
-				SearchTask->StartSubLoops(This->Overlaps.Num(), 8);
-			};
+		if (Overlaps.IsEmpty())
+		{
+			WrapUp();
+			return;
+		}
 
-		PreparationTask->OnSubLoopStartCallback =
+		PCGEX_ASYNC_GROUP_CHKD_VOID(AsyncManager, SearchTask)
+		SearchTask->OnCompleteCallback = WrapUp;
+		SearchTask->OnSubLoopStartCallback =
 			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				const TSharedPtr<PCGExPointsMT::IBatch> Parent = This->ParentBatch.Pin();
-				PCGEX_SCOPE_LOOP(i)
-				{
-					const TSharedPtr<PCGExData::FFacade> OtherFacade = Parent->ProcessorFacades[i];
-					if (This->PointDataFacade == OtherFacade) { continue; } // Skip self
-
-					const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*Parent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
-
-					const FBox Intersection = This->Bounds.Overlap(OtherProcessor->GetBounds());
-					if (!Intersection.IsValid) { continue; } // No overlap
-
-					This->RegisterOverlap(&OtherProcessor.Get(), Intersection);
-				}
+				PCGEX_SCOPE_LOOP(i) { This->ResolveOverlap(i); }
 			};
-		PreparationTask->StartSubLoops(ParentBatch.Pin()->ProcessorFacades.Num(), 64);
+		SearchTask->StartSubLoops(Overlaps.Num(), 8);
 	}
 
 	void FProcessor::Write()
@@ -23,16 +23,17 @@ PCGExTensor::FTensorSample FPCGExTensorPathFlow::Sample(const int32 InSeedIndex,
 	const FVector& InPosition = InProbe.GetLocation();
 	PCGExTensor::FEffectorSamples Samples = PCGExTensor::FEffectorSamples();
 
-	for (const TSharedPtr<const FPCGSplineStruct>& Spline : *Splines)
-	{
-		FTransform T = FTransform::Identity;
-		PCGExTensor::FEffectorMetrics Metrics;
-		if (!ComputeFactor(InPosition, *Spline.Get(), Config.Radius, T, Metrics)) { continue; }
-
-		Samples.Emplace_GetRef(
-			FRotationMatrix::MakeFromX(PCGExMath::GetDirection(T.GetRotation(), Config.SplineDirection)).ToQuat().RotateVector(Metrics.Guide),
-			Metrics.Potency, Metrics.Weight);
-	}
+	PCGExTensor::ForEachSplineCandidate(
+		SplineOctree, Splines->Num(), InPosition, [&](const int32 SplineIndex)
+		{
+			FTransform T = FTransform::Identity;
+			PCGExTensor::FEffectorMetrics Metrics;
+			if (!ComputeFactor(InPosition, *(*Splines)[SplineIndex].Get(), Config.Radius, T, Metrics)) { return; }
+
+			Samples.Emplace_GetRef(
+				FRotationMatrix::MakeFromX(PCGExMath::GetDirection(T.GetRotation(), Config.SplineDirection)).ToQuat().RotateVector(Metrics.Guide),
+				Metrics.Potency, Metrics.Weight);
+		});
 
 	return Config.Mutations.Mutate(InProbe, Samples.Flatten(Config.TensorWeight));
 }
@@ -40,11 +41,13 @@ PCGExTensor::FTensorSample FPCGExTensorPathFlow::Sample(const int32 InSeedIndex,
 PCGEX_TENSOR_BOILERPLATE(
 	PathFlow, {
 	NewFactory->Config.Potency *= NewFactory->Config.PotencyScale;
+	NewFactory->InfluenceRadius = NewFactory->Config.Radius;
 	NewFactory->bBuildFromPaths = GetBuildFromPoints();
 	NewFactory->PointType = NewFactory->Config.PointType;
 	NewFactory->bSmoothLinear = NewFactory->Config.bSmoothLinear;
 	}, {
 	NewOperation->Splines = &ManagedSplines;
+	NewOperation->SplineOctree = GetSplineOctree();
 	})
 
 #undef LOCTEXT_NAMESPACE
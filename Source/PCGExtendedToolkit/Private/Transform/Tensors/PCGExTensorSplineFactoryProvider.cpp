@@ -51,6 +51,8 @@ bool UPCGExTensorSplineFactoryData::InitInternalData(FPCGExContext* InContext)
 			if (!bQuietMissingInputError) { PCGE_LOG_C(Error, GraphAndLog, InContext, FTEXT("No splines (no input matches criteria or empty dataset)")); }
 			return false;
 		}
+
+		BuildSplineOctree(ManagedSplines.Num(), [&](const int32 Index) -> const FPCGSplineStruct& { return *ManagedSplines[Index].Get(); });
 	}
 	else
 	{
@@ -75,16 +77,68 @@ bool UPCGExTensorSplineFactoryData::InitInternalData(FPCGExContext* InContext)
 			if (!bQuietMissingInputError) { PCGE_LOG_C(Error, GraphAndLog, InContext, FTEXT("No splines (no input matches criteria or empty dataset)")); }
 			return false;
 		}
+
+		BuildSplineOctree(Splines.Num(), [&](const int32 Index) -> const FPCGSplineStruct& { return Splines[Index]; });
 	}
 
 	return true;
 }
 
+void UPCGExTensorSplineFactoryData::BuildSplineOctree(const int32 NumSplines, const TFunctionRef<const FPCGSplineStruct&(int32)>& GetSpline)
+{
+	// One item per spline segment, bounds expanded by the largest influence radius reached along that segment.
+	// Sub-samples are padded by the largest step between them so curvature between samples stays covered.
+	constexpr int32 NumSubSteps = 8;
+	constexpr double SubStep = 1.0 / static_cast<double>(NumSubSteps);
+
+	TArray<PCGEx::FIndexedItem> Items;
+	FBox OctreeBounds = FBox(ForceInit);
+
+	for (int i = 0; i < NumSplines; i++)
+	{
+		const FPCGSplineStruct& Spline = GetSpline(i);
+		const int32 NumSegments = Spline.GetNumberOfSplineSegments();
+
+		Items.Reserve(Items.Num() + NumSegments);
+
+		for (int s = 0; s < NumSegments; s++)
+		{
+			FBox Box = FBox(ForceInit);
+			FVector PrevLocation = FVector::ZeroVector;
+			double MaxScale = 0;
+			double MaxStep = 0;
+
+			for (int k = 0; k <= NumSubSteps; k++)
+			{
+				const FTransform T = Spline.GetTransformAtSplineInputKey(static_cast<float>(s + k * SubStep), ESplineCoordinateSpace::World, true);
+				const FVector Location = T.GetLocation();
+				const FVector Scale = T.GetScale3D();
+
+				Box += Location;
+				MaxScale = FMath::Max(MaxScale, FVector2D(Scale.Y, Scale.Z).Length());
+				if (k > 0) { MaxStep = FMath::Max(MaxStep, FVector::Dist(PrevLocation, Location)); }
+
+				PrevLocation = Location;
+			}
+
+			Box = Box.ExpandBy(MaxScale * InfluenceRadius + MaxStep);
+			OctreeBounds += Box;
+			Items.Emplace(i, FBoxSphereBounds(Box));
+		}
+	}
+
+	if (Items.IsEmpty()) { return; }
+
+	SplineOctree = MakeShared<PCGEx::FIndexedItemOctree>(OctreeBounds.GetCenter(), OctreeBounds.GetExtent().Length());
+	for (const PCGEx::FIndexedItem& Item : Items) { SplineOctree->AddElement(Item); }
+}
+
 void UPCGExTensorSplineFactoryData::BeginDestroy()
 {
 	Super::BeginDestroy();
 	ManagedSplines.Empty();
 	Splines.Empty();
+	SplineOctree.Reset();
 }
 
 TArray<FPCGPinProperties> UPCGExTensorSplineFactoryProviderSettings::InputPinProperties() const
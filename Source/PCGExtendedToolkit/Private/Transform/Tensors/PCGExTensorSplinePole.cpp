@@ -18,17 +18,18 @@ PCGExTensor::FTensorSample FPCGExTensorSplinePole::Sample(const int32 InSeedInde
 	const FVector& InPosition = InProbe.GetLocation();
 	PCGExTensor::FEffectorSamples Samples = PCGExTensor::FEffectorSamples();
 
-	for (const FPCGSplineStruct& Spline : *Splines)
-	{
-		FTransform T = FTransform::Identity;
-		PCGExTensor::FEffectorMetrics Metrics;
+	PCGExTensor::ForEachSplineCandidate(
+		SplineOctree, Splines->Num(), InPosition, [&](const int32 SplineIndex)
+		{
+			FTransform T = FTransform::Identity;
+			PCGExTensor::FEffectorMetrics Metrics;
 
-		if (!ComputeFactor(InPosition, Spline, Config.Radius, T, Metrics)) { continue; }
+			if (!ComputeFactor(InPosition, (*Splines)[SplineIndex], Config.Radius, T, Metrics)) { return; }
 
-		Samples.Emplace_GetRef(
-			FRotationMatrix::MakeFromX((InPosition - T.GetLocation()).GetSafeNormal()).ToQuat().RotateVector(Metrics.Guide),
-			Metrics.Potency, Metrics.Weight);
-	}
+			Samples.Emplace_GetRef(
+				FRotationMatrix::MakeFromX((InPosition - T.GetLocation()).GetSafeNormal()).ToQuat().RotateVector(Metrics.Guide),
+				Metrics.Potency, Metrics.Weight);
+		});
 
 	return Config.Mutations.Mutate(InProbe, Samples.Flatten(Config.TensorWeight));
 }
@@ -42,8 +43,10 @@ bool UPCGExTensorSplinePoleFactory::Prepare(FPCGExContext* InContext, const TSha
 PCGEX_TENSOR_BOILERPLATE(
 	SplinePole, {
 	NewFactory->Config.Potency *=NewFactory->Config.PotencyScale;
+	NewFactory->InfluenceRadius = NewFactory->Config.Radius;
 	}, {
 	NewOperation->Splines = &Splines;
+	NewOperation->SplineOctree = GetSplineOctree();
 	})
 
 #undef LOCTEXT_NAMESPACE
@@ -186,6 +186,13 @@ public:
 		Blender->Blend(SourceIndexA, SourceIndexB, TargetIndex, Config.Weighting.ScoreCurveObj->Eval(InWeight));
 	}
 
+	virtual void BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> InWeights)
+	{
+		TArray<double, TInlineAllocator<64>> Weights;
+		EvalWeights(InWeights, Weights);
+		Blender->BlendRange(SourceIndicesA, SourceIndicesB, TargetIndices, Weights);
+	}
+
 	virtual PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex)
 	{
 		return Blender->BeginMultiBlend(TargetIndex);
@@ -196,6 +203,13 @@ public:
 		Blender->MultiBlend(SourceIndex, TargetIndex, Config.Weighting.ScoreCurveObj->Eval(InWeight), Tracker);
 	}
 
+	virtual void MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> InWeights, PCGEx::FOpStats& Tracker)
+	{
+		TArray<double, TInlineAllocator<16>> Weights;
+		EvalWeights(InWeights, Weights);
+		Blender->MultiBlendRange(SourceIndices, TargetIndex, Weights, Tracker);
+	}
+
 	virtual void EndMultiBlend(const int32 TargetIndex, PCGEx::FOpStats& Tracker)
 	{
 		Blender->EndMultiBlend(TargetIndex, Tracker);
@@ -204,6 +218,14 @@ public:
 	virtual void CompleteWork(TSet<TSharedPtr<PCGExData::IBuffer>>& OutDisabledBuffers);
 
 protected:
+	template <typename AllocatorType>
+	void EvalWeights(const TArrayView<const double> InWeights, TArray<double, AllocatorType>& OutWeights) const
+	{
+		OutWeights.SetNumUninitialized(InWeights.Num());
+		const FRichCurve* Curve = Config.Weighting.ScoreCurveObj;
+		for (int i = 0; i < InWeights.Num(); i++) { OutWeights[i] = Curve->Eval(InWeights[i]); }
+	}
+
 	bool CopyAndFixSiblingSelector(FPCGExContext* InContext, FPCGAttributePropertyInputSelector& Selector) const;
 
 	TSharedPtr<PCGExDetails::TSettingValue<double>> Weight;
@@ -68,6 +68,12 @@ namespace PCGExDataBlending
 			for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->Blend(SourceAIndex, SourceBIndex, TargetIndex, InWeight); }
 		}
 
+		// Ranged blend; each operation runs over the whole range before moving to the next one
+		FORCEINLINE void BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> InWeights) const
+		{
+			for (int i = 0; i < Operations->Num(); i++) { (*(Operations->GetData() + i))->BlendRange(SourceIndicesA, SourceIndicesB, TargetIndices, InWeights); }
+		}
+
 		void InitScopedTrackers(const TArray<PCGExMT::FScope>& Loops);
 		FORCEINLINE TArray<PCGEx::FOpStats>& GetScopedTrackers(const PCGExMT::FScope& Scope) const { return ScopedTrackers->Get_Ref(Scope); }
 
@@ -75,6 +81,7 @@ namespace PCGExDataBlending
 
 		void virtual BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override;
 		void virtual MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double InWeight, TArray<PCGEx::FOpStats>& Trackers) const override;
+		void MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> InWeights, TArray<PCGEx::FOpStats>& Trackers) const;
 		void virtual EndMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override;
 
 		void Cleanup(FPCGExContext* InContext);
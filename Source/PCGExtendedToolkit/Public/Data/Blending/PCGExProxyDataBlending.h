@@ -123,6 +123,29 @@ namespace PCGExDataBlending
 		TSharedPtr<PCGExDetails::FDistances> Distances;
 	};
 
+	/**
+	 * Weighted points flattened into contiguous runs sharing the same source IO,
+	 * so each run can be fed to a single ranged multiblend. Order is preserved.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FWeightedRuns
+	{
+		struct FRun
+		{
+			int32 IO = -1;
+			int32 Start = 0;
+			int32 Count = 0;
+		};
+
+		TArray<int32, TInlineAllocator<16>> Indices;
+		TArray<double, TInlineAllocator<16>> Weights;
+		TArray<FRun, TInlineAllocator<8>> Runs;
+
+		void Build(const TArray<PCGExData::FWeightedPoint>& InWeightedPoints);
+
+		FORCEINLINE TArrayView<const int32> GetIndices(const FRun& Run) const { return MakeArrayView(Indices.GetData() + Run.Start, Run.Count); }
+		FORCEINLINE TArrayView<const double> GetWeights(const FRun& Run) const { return MakeArrayView(Weights.GetData() + Run.Start, Run.Count); }
+	};
+
 	/**
 	 * Simple C=AxB blend
 	 */
@@ -147,6 +170,13 @@ namespace PCGExDataBlending
 
 		virtual void Div(const int32 TargetIndex, const double Divider) = 0;
 
+		// Target[i] = SourceA[i]|SourceB[i]
+		// Ranged version of Blend, runs the whole range through a single typed kernel
+		virtual void BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> Weights) = 0;
+
+		// Same as a series of MultiBlend calls on a single target, but accumulates in a local value
+		virtual void MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> Weights, PCGEx::FOpStats& Tracker) = 0;
+
 		virtual TSharedPtr<PCGExData::IBuffer> GetOutputBuffer() const = 0;
 
 		virtual bool InitFromParam(
@@ -200,6 +230,12 @@ namespace PCGExDataBlending
 		virtual void Div(const int32 TargetIndex, const double Divider) override
 		PCGEX_NOT_IMPLEMENTED(Div(const int32 TargetIndex, const double Divider))
 
+		virtual void BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> Weights) override
+		PCGEX_NOT_IMPLEMENTED(BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> Weights))
+
+		virtual void MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> Weights, PCGEx::FOpStats& Tracker) override
+		PCGEX_NOT_IMPLEMENTED(MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> Weights, PCGEx::FOpStats& Tracker))
+
 		virtual TSharedPtr<PCGExData::IBuffer> GetOutputBuffer() const override { return C ? C->GetBuffer() : nullptr; }
 
 		virtual bool InitFromParam(
@@ -269,44 +305,101 @@ namespace PCGExDataBlending
 		{
 		}
 
-		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight = 1) override
+		// Typed A|B kernel, shared by the per-element and ranged paths
+		static FORCEINLINE T_WORKING BlendAB(const T_WORKING& ValueA, const T_WORKING& ValueB, const double Weight)
 		{
 			BOOKMARK_BLENDMODE
 
+			if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { return PCGExBlend::Div(PCGExBlend::Add(ValueA,ValueB), 2); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { return PCGExBlend::WeightedAdd(ValueA, ValueB, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { return PCGExBlend::Min(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { return PCGExBlend::Max(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { return PCGExBlend::Add(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { return PCGExBlend::Sub(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { return PCGExBlend::Mult(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { return PCGExBlend::Div(ValueA, PCGEx::Convert<double>(ValueB)); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { return PCGExBlend::WeightedAdd(ValueA,ValueB, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { return PCGExBlend::WeightedSub(ValueA, ValueB, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { return PCGExBlend::Lerp(ValueA,ValueB, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { return PCGExBlend::UnsignedMin(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { return PCGExBlend::UnsignedMax(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { return PCGExBlend::AbsoluteMin(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { return PCGExBlend::AbsoluteMax(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { return ValueB; }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { return ValueA; }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { return PCGExBlend::NaiveHash(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { return PCGExBlend::NaiveUnsignedHash(ValueA,ValueB); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { return PCGExBlend::ModSimple(ValueA, PCGEx::Convert<T_WORKING, double>(ValueB)); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { return PCGExBlend::ModComplex(ValueA,ValueB); }
+			else { return ValueB; }
+		}
+
+		// Typed Target|Source kernel used when accumulating multiple sources
+		static FORCEINLINE T_WORKING BlendMulti(const T_WORKING& Target, const T_WORKING& Source, const double Weight)
+		{
+			if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { return PCGExBlend::Add(Source,Target); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { return PCGExBlend::WeightedAdd(Target, Source, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { return PCGExBlend::Min(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { return PCGExBlend::Max(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { return PCGExBlend::Add(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { return PCGExBlend::Sub(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { return PCGExBlend::Mult(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { return PCGExBlend::Div(Target, PCGEx::Convert<double>(Source)); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { return PCGExBlend::WeightedAdd(Target,Source, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { return PCGExBlend::WeightedSub(Target, Source, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { return PCGExBlend::Lerp(Target,Source, Weight); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { return PCGExBlend::UnsignedMin(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { return PCGExBlend::UnsignedMax(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { return PCGExBlend::AbsoluteMin(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { return PCGExBlend::AbsoluteMax(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { return Target; }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { return Source; }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { return PCGExBlend::NaiveHash(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { return PCGExBlend::NaiveUnsignedHash(Target,Source); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { return PCGExBlend::ModSimple(Target, PCGEx::Convert<T_WORKING, double>(Source)); }
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { return PCGExBlend::ModComplex(Target,Source); }
+			else { return Target; }
+		}
+
+		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight = 1) override
+		{
 			check(A)
 			if constexpr (BLEND_MODE != EPCGExABBlendingType::CopySource) { check(B) }
 			check(C)
 
-#define PCGEX_A A->Get(SourceIndexA)
-#define PCGEX_B B->Get(SourceIndexB)
-
 			if constexpr (BLEND_MODE == EPCGExABBlendingType::None)
 			{
 			}
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { C->Set(TargetIndex, PCGExBlend::Div(PCGExBlend::Add(PCGEX_A,PCGEX_B), 2)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_A, PCGEX_B, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { C->Set(TargetIndex, PCGExBlend::Min(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { C->Set(TargetIndex, PCGExBlend::Max(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { C->Set(TargetIndex, PCGExBlend::Add(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { C->Set(TargetIndex, PCGExBlend::Sub(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { C->Set(TargetIndex, PCGExBlend::Mult(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { C->Set(TargetIndex, PCGExBlend::Div(PCGEX_A, PCGEx::Convert<double>(PCGEX_B))); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_A,PCGEX_B, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { C->Set(TargetIndex, PCGExBlend::WeightedSub(PCGEX_A, PCGEX_B, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { C->Set(TargetIndex, PCGExBlend::Lerp(PCGEX_A,PCGEX_B, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { C->Set(TargetIndex, PCGExBlend::UnsignedMin(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { C->Set(TargetIndex, PCGExBlend::UnsignedMax(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { C->Set(TargetIndex, PCGExBlend::AbsoluteMin(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { C->Set(TargetIndex, PCGExBlend::AbsoluteMax(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { C->Set(TargetIndex, PCGEX_B); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { C->Set(TargetIndex, PCGEX_A); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { C->Set(TargetIndex, PCGExBlend::NaiveHash(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { C->Set(TargetIndex, PCGExBlend::NaiveUnsignedHash(PCGEX_A,PCGEX_B)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { C->Set(TargetIndex, PCGExBlend::ModSimple(PCGEX_A, PCGEx::Convert<T_WORKING, double>(PCGEX_B))); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { C->Set(TargetIndex, PCGExBlend::ModComplex(PCGEX_A,PCGEX_B)); }
-
-#undef PCGEX_A
-#undef PCGEX_B
+			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { C->Set(TargetIndex, A->Get(SourceIndexA)); }
+			else { C->Set(TargetIndex, BlendAB(A->Get(SourceIndexA), B->Get(SourceIndexB), Weight)); }
+		}
+
+		virtual void BlendRange(const TArrayView<const int32> SourceIndicesA, const TArrayView<const int32> SourceIndicesB, const TArrayView<const int32> TargetIndices, const TArrayView<const double> Weights) override
+		{
+			check(A)
+			if constexpr (BLEND_MODE != EPCGExABBlendingType::CopySource) { check(B) }
+			check(C)
+
+			const int32 NumValues = TargetIndices.Num();
+			if (!NumValues) { return; }
+
+			if constexpr (BLEND_MODE != EPCGExABBlendingType::None)
+			{
+				TArray<T_WORKING, TInlineAllocator<64>> ValuesA;
+				ValuesA.SetNum(NumValues);
+				A->GetRange(SourceIndicesA, ValuesA);
+
+				if constexpr (BLEND_MODE != EPCGExABBlendingType::CopySource)
+				{
+					TArray<T_WORKING, TInlineAllocator<64>> ValuesB;
+					ValuesB.SetNum(NumValues);
+					B->GetRange(SourceIndicesB, ValuesB);
+
+					for (int i = 0; i < NumValues; i++) { ValuesA[i] = BlendAB(ValuesA[i], ValuesB[i], Weights[i]); }
+				}
+
+				C->SetRange(TargetIndices, ValuesA);
+			}
 		}
 
 		virtual PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex) override
@@ -364,44 +457,56 @@ namespace PCGExDataBlending
 				Tracker.Weight += Weight;
 			};
 
-#define PCGEX_SRC A->Get(SourceIndex)
-#define PCGEX_TGT C->GetCurrent(TargetIndex) // We read from current value during multiblend
-
 			if (Tracker.Count < 0)
 			{
 				Tracker.Count = 0;
-				C->Set(TargetIndex, PCGEX_SRC);
+				C->Set(TargetIndex, A->Get(SourceIndex));
 				return;
 			}
 
-			if constexpr (BLEND_MODE == EPCGExABBlendingType::None)
+			if constexpr (BLEND_MODE != EPCGExABBlendingType::None)
+			{
+				// We read from current value during multiblend
+				C->Set(TargetIndex, BlendMulti(C->GetCurrent(TargetIndex), A->Get(SourceIndex), Weight));
+			}
+		}
+
+		virtual void MultiBlendRange(const TArrayView<const int32> SourceIndices, const int32 TargetIndex, const TArrayView<const double> Weights, PCGEx::FOpStats& Tracker) override
+		{
+			check(A)
+			check(C)
+
+			const int32 NumValues = SourceIndices.Num();
+			if (!NumValues) { return; }
+
+			TArray<T_WORKING, TInlineAllocator<16>> Values;
+			Values.SetNum(NumValues);
+			A->GetRange(SourceIndices, Values);
+
+			// Accumulate locally, target is only read & written once
+			int32 i = 0;
+			T_WORKING Result = T_WORKING{};
+
+			if (Tracker.Count < 0)
 			{
+				Result = Values[0];
+				Tracker.Count = 1;
+				Tracker.Weight += Weights[0];
+				i = 1;
 			}
-			if constexpr (BLEND_MODE == EPCGExABBlendingType::Average) { C->Set(TargetIndex, PCGExBlend::Add(PCGEX_SRC,PCGEX_TGT)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Weight) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_TGT, PCGEX_SRC, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Min) { C->Set(TargetIndex, PCGExBlend::Min(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Max) { C->Set(TargetIndex, PCGExBlend::Max(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Add) { C->Set(TargetIndex, PCGExBlend::Add(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Subtract) { C->Set(TargetIndex, PCGExBlend::Sub(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Multiply) { C->Set(TargetIndex, PCGExBlend::Mult(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Divide) { C->Set(TargetIndex, PCGExBlend::Div(PCGEX_TGT, PCGEx::Convert<double>(PCGEX_SRC))); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedAdd) { C->Set(TargetIndex, PCGExBlend::WeightedAdd(PCGEX_TGT,PCGEX_SRC, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::WeightedSubtract) { C->Set(TargetIndex, PCGExBlend::WeightedSub(PCGEX_TGT, PCGEX_SRC, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Lerp) { C->Set(TargetIndex, PCGExBlend::Lerp(PCGEX_TGT,PCGEX_SRC, Weight)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMin) { C->Set(TargetIndex, PCGExBlend::UnsignedMin(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedMax) { C->Set(TargetIndex, PCGExBlend::UnsignedMax(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMin) { C->Set(TargetIndex, PCGExBlend::AbsoluteMin(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::AbsoluteMax) { C->Set(TargetIndex, PCGExBlend::AbsoluteMax(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopyTarget) { C->Set(TargetIndex, PCGEX_TGT); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::CopySource) { C->Set(TargetIndex, PCGEX_SRC); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Hash) { C->Set(TargetIndex, PCGExBlend::NaiveHash(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::UnsignedHash) { C->Set(TargetIndex, PCGExBlend::NaiveUnsignedHash(PCGEX_TGT,PCGEX_SRC)); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::Mod) { C->Set(TargetIndex, PCGExBlend::ModSimple(PCGEX_TGT, PCGEx::Convert<T_WORKING, double>(PCGEX_SRC))); }
-			else if constexpr (BLEND_MODE == EPCGExABBlendingType::ModCW) { C->Set(TargetIndex, PCGExBlend::ModComplex(PCGEX_TGT,PCGEX_SRC)); }
-
-
-#undef PCGEX_SRC
-#undef PCGEX_TGT
+			else
+			{
+				Result = C->GetCurrent(TargetIndex);
+			}
+
+			for (; i < NumValues; i++)
+			{
+				if constexpr (BLEND_MODE != EPCGExABBlendingType::None) { Result = BlendMulti(Result, Values[i], Weights[i]); }
+				Tracker.Count++;
+				Tracker.Weight += Weights[i];
+			}
+
+			C->Set(TargetIndex, Result);
 		}
 
 		virtual void EndMultiBlend(const int32 TargetIndex, PCGEx::FOpStats& Tracker) override
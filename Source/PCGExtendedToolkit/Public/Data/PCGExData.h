@@ -150,6 +150,12 @@ namespace PCGExData
 		// Unsafe read from input
 		virtual const T& Read(const int32 Index) const = 0;
 
+		// Unsafe contiguous read from input, starting at Start
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) const
+		{
+			for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = Read(Start + i); }
+		}
+
 		// Unsafe read from output
 		virtual const T& GetValue(const int32 Index) = 0;
 
@@ -208,6 +214,12 @@ namespace PCGExData
 		virtual bool ReadsFromOutput() override { return InValues == OutValues; }
 
 		virtual const T& Read(const int32 Index) const override { return *(InValues->GetData() + Index); }
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) const override
+		{
+			const T* InData = InValues->GetData() + Start;
+			for (int i = 0; i < OutValues.Num(); i++) { OutValues[i] = InData[i]; }
+		}
+
 		virtual const T& GetValue(const int32 Index) override { return *(OutValues->GetData() + Index); }
 		virtual void SetValue(const int32 Index, const T& Value) override { *(OutValues->GetData() + Index) = Value; }
 
@@ -516,6 +528,11 @@ namespace PCGExData
 			return InValue;
 		}
 
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) const override
+		{
+			for (T& Value : OutValues) { Value = InValue; }
+		}
+
 		virtual const T& GetValue(const int32 Index) override
 		{
 			FReadScopeLock ReadScopeLock(BufferLock);
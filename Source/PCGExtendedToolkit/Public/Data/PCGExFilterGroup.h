@@ -106,6 +106,14 @@ namespace PCGExFilterGroup
 	protected:
 		const TSet<PCGExFactories::EType>* SupportedFactoriesTypes = nullptr;
 		TArray<TSharedPtr<PCGExPointFilter::IFilter>> ManagedFilters;
+		mutable PCGExPointFilter::FFilterOrder ScopeOrder;
+
+		static int32 CountActive(const TConstArrayView<int8> Mask)
+		{
+			int32 NumActive = 0;
+			for (const int8 Value : Mask) { NumActive += Value != 0; }
+			return NumActive;
+		}
 
 		virtual bool InitManaged(FPCGExContext* InContext);
 		bool InitManagedFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::IFilter>& Filter) const;
@@ -150,6 +158,24 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters) { if (!Filter->Test(IO, ParentCollection)) { return bInvert; } }
 			return !bInvert;
 		}
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const override
+		{
+			TArray<int8> Passing;
+			if (bInvert) { Passing.Append(InOutMask.GetData(), InOutMask.Num()); }
+
+			const TArrayView<int8> Mask = bInvert ? TArrayView<int8>(Passing) : InOutMask;
+
+			int32 NumActive = CountActive(Mask);
+			ScopeOrder.ForEach(
+				NumActive, [&](const TSharedPtr<PCGExPointFilter::IFilter>& Filter, int32& OutNumActive)
+				{
+					Filter->TestScope(Scope, Mask);
+					OutNumActive = CountActive(Mask);
+				});
+
+			if (bInvert) { for (int i = 0; i < Passing.Num(); i++) { InOutMask[i] &= !Passing[i]; } }
+		}
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FFilterGroupOR final : public FFilterGroup
@@ -189,5 +215,31 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::IFilter>& Filter : ManagedFilters) { if (Filter->Test(IO, ParentCollection)) { return !bInvert; } }
 			return bInvert;
 		}
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const override
+		{
+			// Pending holds what hasn't passed any filter yet; each filter only tests those
+			TArray<int8> Pending(InOutMask.GetData(), InOutMask.Num());
+			TArray<int8> Passing;
+			Passing.SetNumUninitialized(Pending.Num());
+
+			int32 NumPending = CountActive(Pending);
+			ScopeOrder.ForEach(
+				NumPending, [&](const TSharedPtr<PCGExPointFilter::IFilter>& Filter, int32& OutNumPending)
+				{
+					FMemory::Memcpy(Passing.GetData(), Pending.GetData(), Pending.Num() * sizeof(int8));
+					Filter->TestScope(Scope, Passing);
+
+					OutNumPending = 0;
+					for (int i = 0; i < Pending.Num(); i++)
+					{
+						Pending[i] &= !Passing[i];
+						OutNumPending += Pending[i] != 0;
+					}
+				});
+
+			if (bInvert) { FMemory::Memcpy(InOutMask.GetData(), Pending.GetData(), Pending.Num() * sizeof(int8)); }
+			else { for (int i = 0; i < Pending.Num(); i++) { InOutMask[i] &= !Pending[i]; } }
+		}
 	};
 }
@@ -131,6 +131,10 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const; // destined for collection only, is expected to test internal PointDataFacade directly.
 
+		// Columnar evaluation of a whole scope. InOutMask is scope-relative; entries that are still set on input are
+		// the active selection, and are cleared when they fail this filter. Default implementation falls back to Test(Index).
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const;
+
 		virtual void SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 		{
 		}
@@ -170,6 +174,79 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node) const override final;
 		virtual bool Test(const PCGExGraph::FEdge& Edge) const override final;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const override;
+	};
+
+	/**
+	 * Scope evaluation order of a list of short-circuited filters.
+	 * The first scopes are profiled for per-filter cost and for how much of the active selection each filter drops,
+	 * then the order is frozen so that cheap, selective filters run first. Filters are pure, so results don't change.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FFilterOrder
+	{
+	public:
+		static constexpr int32 NumProfiledScopes = 8;
+
+		FFilterOrder() = default;
+
+		void Init(const TArray<TSharedPtr<IFilter>>& InFilters);
+
+		// RunFilter(Filter, InOutNumActive) evaluates a single filter and updates the active count
+		template <typename FRunFilter>
+		void ForEach(int32& InOutNumActive, FRunFilter&& RunFilter)
+		{
+			if (bFrozen.load(std::memory_order_acquire))
+			{
+				for (const TSharedPtr<IFilter>& Filter : Order)
+				{
+					if (!InOutNumActive) { return; }
+					RunFilter(Filter, InOutNumActive);
+				}
+				return;
+			}
+
+			{
+				FReadScopeLock ReadScopeLock(OrderLock);
+				for (int i = 0; i < Order.Num(); i++)
+				{
+					if (!InOutNumActive) { break; }
+
+					const int32 NumBefore = InOutNumActive;
+					const uint64 StartCycles = FPlatformTime::Cycles64();
+
+					RunFilter(Order[i], InOutNumActive);
+
+					Profiles[i].Record(FPlatformTime::Cycles64() - StartCycles, NumBefore, NumBefore - InOutNumActive);
+				}
+			}
+
+			if (FPlatformAtomics::InterlockedIncrement(&NumSampledScopes) == NumProfiledScopes) { Freeze(); }
+		}
+
+	protected:
+		struct FProfile
+		{
+			int64 Cycles = 0;
+			int64 Tested = 0;
+			int64 Dropped = 0;
+
+			void Record(const uint64 InCycles, const int32 InTested, const int32 InDropped)
+			{
+				FPlatformAtomics::InterlockedAdd(&Cycles, static_cast<int64>(InCycles));
+				FPlatformAtomics::InterlockedAdd(&Tested, static_cast<int64>(InTested));
+				FPlatformAtomics::InterlockedAdd(&Dropped, static_cast<int64>(InDropped));
+			}
+		};
+
+		FRWLock OrderLock;
+		std::atomic<bool> bFrozen{true};
+		int32 NumSampledScopes = 0;
+
+		TArray<TSharedPtr<IFilter>> Order;
+		TArray<FProfile> Profiles;
+
+		void Freeze();
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FManager : public TSharedFromThis<FManager>
@@ -198,6 +275,9 @@ namespace PCGExPointFilter
 		virtual int32 Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults);
 		virtual int32 Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults);
 
+		// Filter-at-a-time evaluation of a scope, InOutMask is scope-relative and must be initialized to the active selection.
+		virtual int32 TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask);
+
 		virtual int32 Test(const TArrayView<PCGExCluster::FNode> Items, const TArrayView<int8> OutResults);
 		virtual int32 Test(const TArrayView<PCGExCluster::FNode> Items, const TSharedPtr<TArray<int8>>& OutResults);
 		virtual int32 Test(const TArrayView<PCGExCluster::FEdge> Items, const TArrayView<int8> OutResults);
@@ -212,6 +292,7 @@ namespace PCGExPointFilter
 	protected:
 		const TSet<PCGExFactories::EType>* SupportedFactoriesTypes = nullptr;
 		TArray<TSharedPtr<IFilter>> ManagedFilters;
+		FFilterOrder ScopeOrder;
 
 		virtual bool InitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& Filter);
 		virtual bool PostInit(FPCGExContext* InContext);
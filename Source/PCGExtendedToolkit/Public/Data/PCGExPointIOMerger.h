@@ -66,6 +66,12 @@ protected:
 	// Utils
 	int32 MaxNumElements = 0;
 	TArray<int32> ReverseIndices;
+
+	// Consecutive source ranges, each covering roughly BlockSize destination points.
+	// Attribute copies run one task per (attribute x block) instead of one per (attribute x source).
+	TArray<PCGExMT::FScope> SourceBlocks;
+	void BuildSourceBlocks(const int32 BlockSize);
+	void CopyProperties(const PCGExMT::FScope& Block);
 };
 
 namespace PCGExPointIOMerger
@@ -89,7 +95,7 @@ namespace PCGExPointIOMerger
 			{
 				// From a data domain
 				const T Value = PCGExDataHelpers::ReadDataValue(TypedInAttribute);
-				for (int Index = Scope.Write.Start; Index < Scope.Write.End; Index++) { OutElementsBuffer->SetValue(Index, Value); }
+				for (T& OutValue : MakeArrayView(OutElementsBuffer->GetOutValues()->GetData() + Scope.Write.Start, Scope.Write.Count)) { OutValue = Value; }
 			}
 			else
 			{
@@ -145,32 +151,43 @@ namespace PCGExPointIOMerger
 	};
 
 	template <typename T>
-	class PCGEXTENDEDTOOLKIT_API FWriteAttributeScopeTask final : public PCGExMT::FTask
+	class PCGEXTENDEDTOOLKIT_API FWriteAttributeBlockTask final : public PCGExMT::FTask
 	{
 	public:
-		PCGEX_ASYNC_TASK_NAME(FWriteAttributeScopeTask)
+		PCGEX_ASYNC_TASK_NAME(FWriteAttributeBlockTask)
 
-		FWriteAttributeScopeTask(
-			const TSharedPtr<PCGExData::FPointIO>& InPointIO,
-			const FMergeScope& InScope,
-			const FIdentityRef& InIdentity,
+		FWriteAttributeBlockTask(
+			const TSharedPtr<FPCGExPointIOMerger>& InMerger,
+			const PCGExMT::FScope& InBlock,
+			const int32 InIdentityIndex,
 			const TSharedPtr<PCGExData::TBuffer<T>>& InOutBuffer)
 			: FTask(),
-			  PointIO(InPointIO),
-			  Scope(InScope),
-			  Identity(InIdentity),
+			  Merger(InMerger),
+			  Block(InBlock),
+			  IdentityIndex(InIdentityIndex),
 			  OutBuffer(InOutBuffer)
 		{
 		}
 
-		const TSharedPtr<PCGExData::FPointIO> PointIO;
-		const FMergeScope Scope;
-		const FIdentityRef Identity;
+		const TSharedPtr<FPCGExPointIOMerger> Merger;
+		const PCGExMT::FScope Block;
+		const int32 IdentityIndex;
 		const TSharedPtr<PCGExData::TBuffer<T>> OutBuffer;
 
 		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override
 		{
-			ScopeMerge<T>(Scope, Identity, PointIO, OutBuffer);
+			const FIdentityRef& Identity = Merger->UniqueIdentities[IdentityIndex];
+
+			for (int i = Block.Start; i < Block.End; i++)
+			{
+				const TSharedPtr<PCGExData::FPointIO>& SourceIO = Merger->IOSources[i];
+				const FPCGMetadataAttributeBase* Attribute = SourceIO->GetIn()->Metadata->GetConstAttribute(Identity.Identifier);
+
+				if (!Attribute) { continue; }                            // Missing attribute
+				if (!Identity.IsA(Attribute->GetTypeId())) { continue; } // Type mismatch
+
+				ScopeMerge<T>(Merger->Scopes[i], Identity, SourceIO, OutBuffer);
+			}
 		}
 	};
 }
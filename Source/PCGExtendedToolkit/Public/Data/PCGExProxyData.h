@@ -97,6 +97,24 @@ namespace PCGExData
 		virtual T_WORKING GetCurrent(const int32 Index) const { return Get(Index); };
 		virtual TSharedPtr<IBuffer> GetBuffer() const override { return nullptr; }
 
+		// Ranged accessors, one dispatch per range instead of one per element
+		// Implementations that can reach raw memory should override these.
+
+		virtual void GetRange(const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const
+		{
+			for (int i = 0; i < Indices.Num(); i++) { OutValues[i] = Get(Indices[i]); }
+		}
+
+		virtual void GetCurrentRange(const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const
+		{
+			for (int i = 0; i < Indices.Num(); i++) { OutValues[i] = GetCurrent(Indices[i]); }
+		}
+
+		virtual void SetRange(const TArrayView<const int32> Indices, const TArrayView<const T_WORKING> InValues) const
+		{
+			for (int i = 0; i < Indices.Num(); i++) { Set(Indices[i], InValues[i]); }
+		}
+
 #define PCGEX_CONVERTING_READ(_TYPE, _NAME, ...) FORCEINLINE virtual _TYPE ReadAs##_NAME(const int32 Index) const override { \
 		if constexpr (std::is_same_v<_TYPE, T_WORKING>) { return Get(Index); } \
 		else { return PCGEx::Convert<T_WORKING, _TYPE>(Get(Index)); } \
@@ -160,8 +178,77 @@ namespace PCGExData
 			else { return SubSelection.template Get<T_REAL, T_WORKING>(Buffer->GetValue(Index)); }
 		}
 
+		virtual void GetRange(const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const override
+		{
+			const TArray<T_REAL>* Values = GetRawValues(false);
+			if (!Values)
+			{
+				TBufferProxy<T_WORKING>::GetRange(Indices, OutValues);
+				return;
+			}
+
+			ReadRaw(Values->GetData(), Indices, OutValues);
+		}
+
+		virtual void GetCurrentRange(const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const override
+		{
+			const TArray<T_REAL>* Values = GetRawValues(true);
+			if (!Values)
+			{
+				TBufferProxy<T_WORKING>::GetCurrentRange(Indices, OutValues);
+				return;
+			}
+
+			ReadRaw(Values->GetData(), Indices, OutValues);
+		}
+
+		virtual void SetRange(const TArrayView<const int32> Indices, const TArrayView<const T_WORKING> InValues) const override
+		{
+			TArray<T_REAL>* Values = GetRawValues(true);
+			if (!Values)
+			{
+				TBufferProxy<T_WORKING>::SetRange(Indices, InValues);
+				return;
+			}
+
+			T_REAL* Raw = Values->GetData();
+			for (int i = 0; i < Indices.Num(); i++)
+			{
+				if constexpr (!bSubSelection)
+				{
+					if constexpr (std::is_same_v<T_REAL, T_WORKING>) { Raw[Indices[i]] = InValues[i]; }
+					else { Raw[Indices[i]] = PCGEx::Convert<T_WORKING, T_REAL>(InValues[i]); }
+				}
+				else { SubSelection.template Set<T_REAL, T_WORKING>(Raw[Indices[i]], InValues[i]); }
+			}
+		}
+
 		virtual TSharedPtr<IBuffer> GetBuffer() const override { return Buffer; }
 		virtual bool EnsureReadable() const override { return Buffer->EnsureReadable(); }
+
+	protected:
+		// Element buffers are backed by plain arrays we can walk directly;
+		// anything else (data domain, single value) goes through the virtual path.
+		TArray<T_REAL>* GetRawValues(const bool bOutput) const
+		{
+			if (Buffer->GetUnderlyingDomain() != EDomainType::Elements) { return nullptr; }
+			TArrayBuffer<T_REAL>* ArrayBuffer = static_cast<TArrayBuffer<T_REAL>*>(Buffer.Get());
+			const TSharedPtr<TArray<T_REAL>> Values = bOutput ? ArrayBuffer->GetOutValues() : ArrayBuffer->GetInValues();
+			return Values.Get();
+		}
+
+		void ReadRaw(const T_REAL* Raw, const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const
+		{
+			for (int i = 0; i < Indices.Num(); i++)
+			{
+				if constexpr (!bSubSelection)
+				{
+					if constexpr (std::is_same_v<T_REAL, T_WORKING>) { OutValues[i] = Raw[Indices[i]]; }
+					else { OutValues[i] = PCGEx::Convert<T_REAL, T_WORKING>(Raw[Indices[i]]); }
+				}
+				else { OutValues[i] = SubSelection.template Get<T_REAL, T_WORKING>(Raw[Indices[i]]); }
+			}
+		}
 	};
 
 	template <typename T_REAL, typename T_WORKING, bool bSubSelection, EPCGPointProperties PROPERTY, typename T_VALUERANGE>
@@ -278,6 +365,11 @@ namespace PCGExData
 			return Constant;
 		}
 
+		virtual void GetRange(const TArrayView<const int32> Indices, TArrayView<T_WORKING> OutValues) const override
+		{
+			for (int i = 0; i < Indices.Num(); i++) { OutValues[i] = Constant; }
+		}
+
 		virtual void Set(const int32 Index, const T_WORKING& Value) const override
 		{
 			// This should never happen, check the callstack
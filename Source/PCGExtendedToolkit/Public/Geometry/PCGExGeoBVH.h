@@ -0,0 +1,98 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Flat, double-precision AABB tree over a static set of 3D segments.
+	 * Segments are copied in leaf order so queries walk contiguous memory.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSegmentBVH : public TSharedFromThis<FSegmentBVH>
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0; // First child if Count == 0, otherwise first segment
+			int32 Count = 0;
+
+			FORCEINLINE bool IsLeaf() const { return Count > 0; }
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FVector> Starts;
+		TArray<FVector> Ends;
+		TArray<int32> Indices;
+
+		// Build-time data, released by EndBuild
+		struct FSubtree
+		{
+			int32 Root = -1;
+			TArray<FNode> Nodes;
+		};
+
+		TArray<FVector> RawStarts;
+		TArray<FVector> RawEnds;
+		TArray<FVector> Centers;
+		TArray<FSubtree> Subtrees;
+		int32 MaxLeafSize = 4;
+
+		// Compute the node bounds and, unless it's small enough to be a leaf, split it at the median of its widest centroid axis
+		bool SplitNode(TArray<FNode>& InNodes, const int32 NodeIndex);
+
+	public:
+		FSegmentBVH() = default;
+
+		// Build from a segment accessor; InNumSegments callbacks are made, in order.
+		FSegmentBVH(const int32 InNumSegments, const TFunctionRef<void(int32, FVector&, FVector&)>& GetSegment, const int32 InMaxLeafSize = 4);
+
+		/**
+		 * Staged build, so the bulk of the work can be spread over async tasks :
+		 * BeginBuild splits the top of the tree and returns the number of subtrees left to build,
+		 * BuildSubtree can then run for each of them concurrently, and EndBuild stitches everything together.
+		 */
+		int32 BeginBuild(const int32 InNumSegments, const TFunctionRef<void(int32, FVector&, FVector&)>& GetSegment, const int32 InMaxLeafSize = 4, const int32 InMaxSubtrees = 64);
+		void BuildSubtree(const int32 SubtreeIndex);
+		void EndBuild();
+
+		FORCEINLINE bool IsValid() const { return !Nodes.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Indices.Num(); }
+		FORCEINLINE const FBox& GetBounds() const { return Nodes[0].Bounds; }
+
+		/**
+		 * Find the segment closest to Position.
+		 * Returns the segment index or -1, and outputs the squared distance and the alpha along the segment.
+		 * Ties resolve to the lowest segment index.
+		 */
+		int32 FindClosest(const FVector& Position, double& OutDistSquared, double& OutAlpha, const double MaxDistSquared = MAX_dbl) const;
+
+		template <typename FFunc>
+		void ForEachInBox(const FBox& InBox, FFunc&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (!Node.Bounds.Intersect(InBox)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.Start + Node.Count; i++) { Func(Indices[i], Starts[i], Ends[i]); }
+					continue;
+				}
+
+				Stack.Add(Node.Start + 1);
+				Stack.Add(Node.Start);
+			}
+		}
+	};
+}
@@ -45,6 +45,13 @@ namespace PCGExGeo
 
 	class PCGEXTENDEDTOOLKIT_API TDelaunay2
 	{
+		static constexpr int32 ChunkSize = 4096;
+
+		// Staged extraction state
+		TArray<UE::Geometry::FIndex3i> Triangles;
+		TArray<UE::Geometry::FIndex3i> Adjacencies;
+		TArray<TArray<uint64>> ChunkEdges;
+
 	public:
 		TArray<FDelaunaySite2> Sites;
 
@@ -52,6 +59,8 @@ namespace PCGExGeo
 		TSet<int32> DelaunayHull;
 		bool IsValid = false;
 
+		int32 NumSiteChunks = 0;
+
 		mutable FRWLock ProcessLock;
 
 		TDelaunay2()
@@ -69,10 +78,30 @@ namespace PCGExGeo
 			DelaunayEdges.Empty();
 			DelaunayHull.Empty();
 
+			Triangles.Empty();
+			Adjacencies.Empty();
+			ChunkEdges.Empty();
+			NumSiteChunks = 0;
+
 			IsValid = false;
 		}
 
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+		{
+			if (!Triangulate(Positions, ProjectionDetails)) { return false; }
+
+			for (int i = 0; i < NumSiteChunks; i++) { ExtractSites(i); }
+			EndExtraction();
+
+			return IsValid;
+		}
+
+		/**
+		 * First step of a staged Process : runs the triangulation and prepares site extraction.
+		 * ExtractSites must then be called once for each of the NumSiteChunks chunks, in any order and from any thread,
+		 * followed by EndExtraction.
+		 */
+		bool Triangulate(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
 		{
 			Clear();
 
@@ -81,9 +110,6 @@ namespace PCGExGeo
 			TArray<FVector2D> Positions2D;
 			ProjectionDetails.Project(Positions, Positions2D);
 
-			TArray<UE::Geometry::FIndex3i> Triangles;
-			TArray<UE::Geometry::FIndex3i> Adjacencies;
-
 			{
 				UE::Geometry::FDelaunay2 Triangulation;
 				TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::Triangulate);
@@ -101,43 +127,75 @@ namespace PCGExGeo
 			}
 
 			const int32 NumSites = Triangles.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
+			NumSiteChunks = FMath::DivideAndRoundUp(NumSites, ChunkSize);
 
 			PCGEx::InitArray(Sites, NumSites);
+			ChunkEdges.SetNum(NumSiteChunks);
 
-			for (int i = 0; i < NumSites; i++)
+			return true;
+		}
+
+		// Each edge is emitted once, by the lowest-index site containing it,
+		// so merged edges keep the same order a serial pass would produce.
+		void ExtractSites(const int32 Chunk)
+		{
+			const int32 Start = Chunk * ChunkSize;
+			const int32 End = FMath::Min(Sites.Num(), Start + ChunkSize);
+
+			TArray<uint64>& LocalEdges = ChunkEdges[Chunk];
+			LocalEdges.Reserve((End - Start) * 2);
+
+			for (int32 i = Start; i < End; i++)
 			{
 				FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(Triangles[i], Adjacencies[i], i);
 
 				for (int a = 0; a < 3; a++)
 				{
+					if (Site.Neighbors[a] == -1) { Site.bOnHull = true; }
+
 					for (int b = a + 1; b < 3; b++)
 					{
-						const uint64 H = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]);
-						DelaunayEdges.Add(H);
-
-						if (Site.Neighbors[b] == -1)
+						bool bOwned = true;
+						for (int n = 0; n < 3; n++)
 						{
-							Site.bOnHull = true;
-							DelaunayHull.Add(Site.Vtx[b]);
+							const int32 Neighbor = Site.Neighbors[n];
+							if (Neighbor == -1 || Neighbor > i) { continue; }
+
+							const UE::Geometry::FIndex3i& Other = Triangles[Neighbor];
+							if (Other.Contains(Site.Vtx[a]) && Other.Contains(Site.Vtx[b]))
+							{
+								bOwned = false;
+								break;
+							}
 						}
-					}
 
-					if (Site.Neighbors[a] == -1)
-					{
-						Site.bOnHull = true;
-						DelaunayHull.Add(Site.Vtx[a]);
-						//DelaunayHull.Add(Site.Vtx[PCGExMath::Tile(a + 1, 0, 2)]);
+						if (bOwned) { LocalEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b])); }
 					}
 				}
 			}
+		}
+
+		void EndExtraction()
+		{
+			int32 NumEdges = 0;
+			for (const TArray<uint64>& LocalEdges : ChunkEdges) { NumEdges += LocalEdges.Num(); }
+
+			DelaunayEdges.Reserve(NumEdges);
+			for (const TArray<uint64>& LocalEdges : ChunkEdges) { for (const uint64 H : LocalEdges) { DelaunayEdges.Add(H); } }
+
+			ChunkEdges.Empty();
+
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				if (!Site.bOnHull) { continue; }
+				// Same insertion order as the former nested pass
+				if (Site.Neighbors[1] == -1) { DelaunayHull.Add(Site.Vtx[1]); }
+				if (Site.Neighbors[2] == -1) { DelaunayHull.Add(Site.Vtx[2]); }
+				if (Site.Neighbors[0] == -1) { DelaunayHull.Add(Site.Vtx[0]); }
+			}
 
 			Triangles.Empty();
 			Adjacencies.Empty();
-
-			return IsValid;
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
@@ -229,6 +287,12 @@ namespace PCGExGeo
 
 	class PCGEXTENDEDTOOLKIT_API TDelaunay3
 	{
+		static constexpr int32 ChunkSize = 4096;
+
+		// Staged extraction state
+		TArray<FIntVector4> Tetrahedra;
+		TArray<TArray<uint64>> ChunkEdges;
+
 	public:
 		TArray<FDelaunaySite3> Sites;
 
@@ -238,6 +302,8 @@ namespace PCGExGeo
 
 		bool IsValid = false;
 
+		int32 NumSiteChunks = 0;
+
 		mutable FRWLock ProcessLock;
 
 		TDelaunay3()
@@ -255,11 +321,30 @@ namespace PCGExGeo
 			DelaunayEdges.Empty();
 			DelaunayHull.Empty();
 
+			Tetrahedra.Empty();
+			ChunkEdges.Empty();
+			NumSiteChunks = 0;
+
 			IsValid = false;
 		}
 
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
 		bool Process(const TArrayView<FVector>& Positions)
+		{
+			if (!Triangulate(Positions)) { return false; }
+
+			for (int i = 0; i < NumSiteChunks; i++) { ExtractSites<bComputeHull || bComputeAdjacency>(i); }
+			EndExtraction<bComputeAdjacency, bComputeHull>();
+
+			return IsValid;
+		}
+
+		/**
+		 * First step of a staged Process : runs the tetrahedralization and prepares site extraction.
+		 * ExtractSites must then be called once for each of the NumSiteChunks chunks, in any order and from any thread,
+		 * followed by EndExtraction. Faces must be computed if either adjacency or hull are.
+		 */
+		bool Triangulate(const TArrayView<FVector>& Positions)
 		{
 			Clear();
 			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
@@ -274,21 +359,33 @@ namespace PCGExGeo
 
 			IsValid = true;
 
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
+			Tetrahedra = Tetrahedralization.GetTetrahedra();
 
 			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TSet<uint32> FacesUsage;
-			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
-			if constexpr (bComputeHull) { FacesUsage.Reserve(NumSites); }
+			NumSiteChunks = FMath::DivideAndRoundUp(NumSites, ChunkSize);
 
 			//PCGEx::InitArray(Sites, NumSites);
 			Sites.SetNumUninitialized(NumSites);
+			ChunkEdges.SetNum(NumSiteChunks);
 
-			for (int i = 0; i < NumSites; i++)
+			return true;
+		}
+
+		// Edges are de-duplicated per chunk in first-seen order.
+		// Merging chunks in order then yields the same edge order as a serial pass.
+		template <bool bComputeFaces = false>
+		void ExtractSites(const int32 Chunk)
+		{
+			const int32 Start = Chunk * ChunkSize;
+			const int32 End = FMath::Min(Sites.Num(), Start + ChunkSize);
+
+			TSet<uint64> Seen;
+			Seen.Reserve((End - Start) * 2);
+
+			TArray<uint64>& LocalEdges = ChunkEdges[Chunk];
+			LocalEdges.Reserve((End - Start) * 2);
+
+			for (int32 i = Start; i < End; i++)
 			{
 				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
 				FDelaunaySite3& Site = Sites[i];
@@ -297,11 +394,37 @@ namespace PCGExGeo
 				{
 					for (int b = a + 1; b < 4; b++)
 					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
+						const uint64 H = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]);
+						bool bAlreadySet = false;
+						Seen.Add(H, &bAlreadySet);
+						if (!bAlreadySet) { LocalEdges.Add(H); }
 					}
 				}
 
-				if constexpr (bComputeHull || bComputeAdjacency) { Site.ComputeFaces(); }
+				if constexpr (bComputeFaces) { Site.ComputeFaces(); }
+			}
+		}
+
+		template <bool bComputeAdjacency = false, bool bComputeHull = false>
+		void EndExtraction()
+		{
+			const int32 NumSites = Sites.Num();
+
+			TSet<uint32> FacesUsage;
+			if constexpr (bComputeAdjacency) { Adjacency.Reserve(NumSites * 4); }
+			if constexpr (bComputeHull) { FacesUsage.Reserve(NumSites); }
+
+			int32 NumReserve = 0;
+			for (const TArray<uint64>& LocalEdges : ChunkEdges) { NumReserve += LocalEdges.Num(); }
+
+			DelaunayEdges.Reserve(NumReserve);
+			for (const TArray<uint64>& LocalEdges : ChunkEdges) { for (const uint64 H : LocalEdges) { DelaunayEdges.Add(H); } }
+
+			ChunkEdges.Empty();
+
+			for (int i = 0; i < NumSites; i++)
+			{
+				const FDelaunaySite3& Site = Sites[i];
 
 				if constexpr (bComputeHull && bComputeAdjacency)
 				{
@@ -355,8 +478,6 @@ namespace PCGExGeo
 
 			FacesUsage.Empty();
 			Tetrahedra.Empty();
-
-			return IsValid;
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
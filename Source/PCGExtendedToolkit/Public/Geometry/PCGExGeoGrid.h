@@ -0,0 +1,75 @@
+﻿// Copyright 2025 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Uniform 2D grid of segment lists (CSR layout), over a polyline or polygon.
+	 * Each cell lists the segments that come within Padding of it.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSegmentGrid2D : public TSharedFromThis<FSegmentGrid2D>
+	{
+	protected:
+		const TArray<FVector2D>* Points = nullptr;
+		bool bClosedLoop = false;
+		double Padding = 0;
+
+		FVector2D Origin = FVector2D::ZeroVector;
+		double CellSize = 1;
+		double InvCellSize = 1;
+		int32 NumX = 0;
+		int32 NumY = 0;
+
+		TArray<int32> CellStarts;
+		TArray<int32> CellSegments;
+
+	public:
+		// Points are referenced, not copied, and must outlive the grid
+		FSegmentGrid2D(const TArray<FVector2D>& InPoints, const bool bInClosedLoop, const double InPadding, const int32 InMaxResolution = 128);
+		virtual ~FSegmentGrid2D() = default;
+
+		FORCEINLINE bool IsValid() const { return NumX > 0 && NumY > 0; }
+		FORCEINLINE int32 GetNumSegments() const { return bClosedLoop ? Points->Num() : Points->Num() - 1; }
+
+		FORCEINLINE void GetSegment(const int32 Index, FVector2D& OutA, FVector2D& OutB) const
+		{
+			OutA = *(Points->GetData() + Index);
+			OutB = *(Points->GetData() + (Index + 1) % Points->Num());
+		}
+
+		// Return -1 if the position is outside the grid
+		int32 GetCellIndex(const FVector2D& Position) const;
+
+		/** Squared distance to the closest segment that lies within padding range, MAX_dbl if there is none. */
+		double FindClosestSegment(const FVector2D& Position, int32& OutSegmentIndex) const;
+
+		template <typename FFunc>
+		FORCEINLINE void ForEachSegmentInCell(const int32 CellIndex, FFunc&& Func) const
+		{
+			for (int32 i = CellStarts[CellIndex]; i < CellStarts[CellIndex + 1]; i++) { Func(CellSegments[i]); }
+		}
+
+	protected:
+		void Build(const FBox2D& InBounds, const int32 InMaxResolution);
+	};
+
+	/**
+	 * Inside/Outside/Boundary raster of a polygon.
+	 * Points that fall into non-boundary cells are resolved in O(1); boundary cells only test
+	 * the few edges that cross them, against the exact inclusion state of the cell center.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FPolygonInclusionGrid final : public FSegmentGrid2D
+	{
+	protected:
+		TArray<uint8> CellStates;
+
+	public:
+		explicit FPolygonInclusionGrid(const TArray<FVector2D>& InPolygon, const int32 InMaxResolution = 128);
+
+		bool IsInside(const FVector2D& Position) const;
+	};
+}
@@ -45,15 +45,13 @@ namespace PCGExGeo
 		FORCEINLINE int32 Num() const { return Data.Num(); }
 	};
 
-	class FExtractStaticMeshTask;
-
 	class PCGEXTENDEDTOOLKIT_API FGeoMesh : public TSharedFromThis<FGeoMesh>
 	{
 	public:
 		bool bIsValid = false;
 		bool bIsLoaded = false;
 		TArray<FVector> Vertices;
-		TSet<uint64> Edges;
+		TArray<uint64> Edges; // Unique, in the order they're first met
 		TArray<FIntVector3> Triangles;
 		TArray<FIntVector3> Adjacencies;
 
@@ -63,61 +61,47 @@ namespace PCGExGeo
 		{
 		}
 
-		void MakeDual() // Need triangulate first
-		{
-			if (Triangles.IsEmpty()) { return; }
-
-			TArray<FVector> DualPositions;
-			PCGEx::InitArray(DualPositions, Triangles.Num());
-
-			Edges.Empty();
-
-			for (int i = 0; i < Triangles.Num(); i++)
-			{
-				const FIntVector3& Triangle = Triangles[i];
-				DualPositions[i] = (Vertices[Triangle.X] + Vertices[Triangle.Y] + Vertices[Triangle.Z]) / 3;
-
-				const FIntVector3& Adjacency = Adjacencies[i];
-				if (Adjacency.X != -1) { Edges.Add(PCGEx::H64U(i, Adjacency.X)); }
-				if (Adjacency.Y != -1) { Edges.Add(PCGEx::H64U(i, Adjacency.Y)); }
-				if (Adjacency.Z != -1) { Edges.Add(PCGEx::H64U(i, Adjacency.Z)); }
-			}
-
-			Vertices.Empty(DualPositions.Num());
-			Vertices.Append(DualPositions);
-			DualPositions.Empty();
-
-			Triangles.Empty();
-			Adjacencies.Empty();
-		}
-
-		void MakeHollowDual() // Need triangulate first
-		{
-			if (Triangles.IsEmpty()) { return; }
-
-			const int32 StartIndex = Vertices.Num();
-			TArray<FVector> DualPositions;
-			PCGEx::InitArray(DualPositions, Triangles.Num());
-			PCGEx::InitArray(Vertices, StartIndex + Triangles.Num());
-
-			Edges.Empty();
-
-			for (int i = 0; i < Triangles.Num(); i++)
-			{
-				const FIntVector3& Triangle = Triangles[i];
-				const int32 E = StartIndex + i;
-				Vertices[E] = (Vertices[Triangle.X] + Vertices[Triangle.Y] + Vertices[Triangle.Z]) / 3;
-
-				Edges.Add(PCGEx::H64U(E, Triangle.X));
-				Edges.Add(PCGEx::H64U(E, Triangle.Y));
-				Edges.Add(PCGEx::H64U(E, Triangle.Z));
-			}
-
-			Triangles.Empty();
-			Adjacencies.Empty();
-		}
+		void MakeDual(); // Need triangulate first
+		void MakeHollowDual(); // Need triangulate first
 
 		~FGeoMesh() = default;
+
+	protected:
+		// Edge key along with the triangle slot (Triangle * 3 + Edge) it was emitted from
+		struct FEdgeSlot
+		{
+			uint64 Key = 0;
+			int32 Slot = -1;
+
+			FORCEINLINE bool operator<(const FEdgeSlot& Other) const { return Key == Other.Key ? Slot < Other.Slot : Key < Other.Key; }
+		};
+
+		// Staged build state, each stage runs over scopes that can be processed in parallel
+		TArray<int32> CornerVtx;
+		TArray<FEdgeSlot> SortedEdges;
+		TArray<uint64> SlotEdges;
+		TArray<FVector> DualPositions;
+		bool bBuildAdjacency = false;
+
+		/**
+		 * Sorts each triangle' AB, BC & CA edges so shared edges end up contiguous, ordered by slot.
+		 * Unique, non-degenerate edges are written in the order a serial pass would first meet them;
+		 * triangle adjacency is optionally resolved from the same runs.
+		 * Triangles are filled along the way when adjacency is built.
+		 */
+		void PrepareEdgeSlots(const bool bInBuildAdjacency);
+		void BuildEdgeSlots(const PCGExMT::FScope& Scope);
+		void ResolveEdgeSlots(const PCGExMT::FScope& Scope);
+
+		void PrepareDual();
+		void BuildDual(const PCGExMT::FScope& Scope);
+		void EndDual();
+
+		void PrepareHollowDual();
+		void BuildHollowDual(const PCGExMT::FScope& Scope);
+		void EndHollowDual();
+
+		void CompactSlotEdges();
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FGeoStaticMesh : public FGeoMesh
@@ -147,132 +131,49 @@ namespace PCGExGeo
 		{
 		}
 
-		void ExtractMeshSynchronous()
-		{
-			if (bIsLoaded) { return; }
-			if (!bIsValid) { return; }
-
-			const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
-
-			const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
-
-			TUniquePtr<FMeshLookup> MeshLookup = MakeUnique<FMeshLookup>(VertexBuffer.GetNumVertices() / 3);
-			Edges.Empty();
-
-			const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
-			for (int i = 0; i < Indices.Num(); i += 3)
-			{
-				const int32 AIdx = Indices[i];
-				const int32 BIdx = Indices[i + 1];
-				const int32 CIdx = Indices[i + 2];
-
-				const uint32 A = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(AIdx), CWTolerance), AIdx);
-				const uint32 B = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(BIdx), CWTolerance), BIdx);
-				const uint32 C = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(CIdx), CWTolerance), CIdx);
-
-				if (A != B) { Edges.Add(PCGEx::H64U(A, B)); }
-				if (B != C) { Edges.Add(PCGEx::H64U(B, C)); }
-				if (C != A) { Edges.Add(PCGEx::H64U(C, A)); }
-			}
-
-			PCGEx::InitArray(Vertices, MeshLookup->Num());
-			for (const TPair<uint32, TTuple<int32, uint32>>& Pair : MeshLookup->Data) { Vertices[Pair.Value.Get<1>()] = FVector(VertexBuffer.VertexPosition(Pair.Value.Get<0>())); }
-
-			bIsLoaded = true;
-		}
-
-		void TriangulateMeshSynchronous()
-		{
-			if (bIsLoaded) { return; }
-			if (!bIsValid) { return; }
-
-			Edges.Empty();
-
-			const FStaticMeshLODResources& LODResources = StaticMesh->GetRenderData()->LODResources[0];
-
-			const FPositionVertexBuffer& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
-
-			TUniquePtr<FMeshLookup> MeshLookup = MakeUnique<FMeshLookup>(VertexBuffer.GetNumVertices() / 3);
-			TMap<uint64, uint64> EdgeAdjacency;
-
-			const FIndexArrayView& Indices = LODResources.IndexBuffer.GetArrayView();
-
-			PCGEx::InitArray(Triangles, Indices.Num() / 3);
-			int32 TriangleIndex = 0;
+		void ExtractMeshSynchronous();
+		void TriangulateMeshSynchronous();
 
-			for (int i = 0; i < Indices.Num(); i += 3)
-			{
-				const int32 AIdx = Indices[i];
-				const int32 BIdx = Indices[i + 1];
-				const int32 CIdx = Indices[i + 2];
-
-				const uint32 A = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(AIdx), CWTolerance), AIdx);
-				const uint32 B = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(BIdx), CWTolerance), BIdx);
-				const uint32 C = MeshLookup->Add_GetIdx(PCGEx::GH3(VertexBuffer.VertexPosition(CIdx), CWTolerance), CIdx);
-
-				Edges.Add(PCGEx::H64U(A, B));
-				Edges.Add(PCGEx::H64U(B, C));
-				Edges.Add(PCGEx::H64U(C, A));
-
-				const uint64 AB = PCGEx::H64U(A, B);
-				const uint64 BC = PCGEx::H64U(B, C);
-				const uint64 AC = PCGEx::H64U(A, C);
-
-				Edges.Add(AB);
-				Edges.Add(BC);
-				Edges.Add(AC);
-
-				// Triangles and adjacency
-
-				// Each edge can store its adjacency as a uint64 : left triangle index, right triangle index
-
-				const uint64* AdjacencyABPtr = EdgeAdjacency.Find(AB);
-				const uint64* AdjacencyBCPtr = EdgeAdjacency.Find(BC);
-				const uint64* AdjacencyACPtr = EdgeAdjacency.Find(AC);
-
-				Triangles[TriangleIndex] = FIntVector3(A, B, C);
-
-				if (AdjacencyABPtr) { EdgeAdjacency.Add(AB, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyABPtr))); }
-				else { EdgeAdjacency.Add(AB, PCGEx::NH64(-1, TriangleIndex)); }
-
-				if (AdjacencyBCPtr) { EdgeAdjacency.Add(BC, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyBCPtr))); }
-				else { EdgeAdjacency.Add(BC, PCGEx::NH64(-1, TriangleIndex)); }
-
-				if (AdjacencyACPtr) { EdgeAdjacency.Add(AC, PCGEx::NH64(TriangleIndex, PCGEx::NH64B(*AdjacencyACPtr))); }
-				else { EdgeAdjacency.Add(AC, PCGEx::NH64(-1, TriangleIndex)); }
-
-				TriangleIndex++;
-			}
-
-			PCGEx::InitArray(Adjacencies, Triangles.Num());
-
-			for (int j = 0; j < Triangles.Num(); j++)
-			{
-				FIntVector3 Triangle = Triangles[j];
-
-				uint64* AdjacencyABPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.X, Triangle.Y));
-				uint64* AdjacencyBCPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.Y, Triangle.Z));
-				uint64* AdjacencyACPtr = EdgeAdjacency.Find(PCGEx::H64U(Triangle.X, Triangle.Z));
-
-				Adjacencies[j] = FIntVector3(
-					AdjacencyABPtr ? PCGEx::NH64NOT(*AdjacencyABPtr, j) : -1,
-					AdjacencyBCPtr ? PCGEx::NH64NOT(*AdjacencyBCPtr, j) : -1,
-					AdjacencyACPtr ? PCGEx::NH64NOT(*AdjacencyACPtr, j) : -1);
-			}
-
-			EdgeAdjacency.Empty();
-
-			PCGEx::InitArray(Vertices, MeshLookup->Num());
-			for (const TPair<uint32, TTuple<int32, uint32>>& Pair : MeshLookup->Data) { Vertices[Pair.Value.Get<1>()] = FVector(VertexBuffer.VertexPosition(Pair.Value.Get<0>())); }
-
-			bIsLoaded = true;
-		}
-
-		void ExtractMeshAsync(PCGExMT::FTaskManager* AsyncManager);
+		/**
+		 * Extracts the mesh according to DesiredTriangulationType, running welding, edge & adjacency extraction
+		 * and dual graph generation as task groups on the given manager. OnComplete is called once done.
+		 */
+		void ExtractMeshAsync(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager, PCGExMT::FSimpleCallback&& OnComplete);
 
 		~FGeoStaticMesh()
 		{
 		}
+
+	protected:
+		TWeakPtr<PCGExMT::FTaskManager> AsyncManager;
+		PCGExMT::FSimpleCallback OnExtractionComplete;
+
+		/**
+		 * Welds LOD0 corners by sorting their quantized position hash alongside the corner index.
+		 * Each welded vertex is indexed in order of its first corner, like a serial first-come lookup would.
+		 */
+		TArray<uint64> CornerKeys;
+		TArray<int32> RunFirst;
+		TArray<int8> IsFirst;
+
+		void LoadSynchronous(const bool bTriangulate);
+
+		int32 PrepareWeld();
+		void HashCorners(const PCGExMT::FScope& Scope);
+		void FindWeldRuns(const PCGExMT::FScope& Scope);
+		void NumberVertices();
+		void WeldCorners(const PCGExMT::FScope& Scope);
+
+		// Async pipeline, each stage chains into the next once its group completes
+		void StartWeld();
+		void SortCornerKeys();
+		void StartWeldRuns();
+		void StartWeldCorners();
+		void StartEdges();
+		void SortEdgeSlots();
+		void StartResolveEdges();
+		void StartDual();
+		void EndExtraction();
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FGeoStaticMeshMap : public FGeoMesh
@@ -306,29 +207,4 @@ namespace PCGExGeo
 		{
 		}
 	};
-
-	class PCGEXTENDEDTOOLKIT_API FExtractStaticMeshTask final : public PCGExMT::FTask
-	{
-	public:
-		PCGEX_ASYNC_TASK_NAME(FExtractStaticMeshTask)
-
-		FExtractStaticMeshTask(const TSharedPtr<FGeoStaticMesh>& InGSM) :
-			FTask(), GSM(InGSM)
-		{
-		}
-
-		TSharedPtr<FGeoStaticMesh> GSM;
-
-		virtual void ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override
-		{
-			GSM->ExtractMeshSynchronous();
-		}
-	};
-
-	inline void FGeoStaticMesh::ExtractMeshAsync(PCGExMT::FTaskManager* AsyncManager)
-	{
-		if (bIsLoaded) { return; }
-		if (!bIsValid) { return; }
-		PCGEX_LAUNCH(FExtractStaticMeshTask, SharedThis(this))
-	}
 }
@@ -9,13 +9,90 @@
 
 namespace PCGExGeo
 {
+	struct PCGEXTENDEDTOOLKIT_API FVoronoiCellFace
+	{
+		TArray<int32> Vertices; // Indices into the clipped vertices; a single segment for 2D cells, a closed polygon for 3D cells
+		int32 Neighbor = -1;    // Site on the other side of that face, -1 if the face lies on the clipping bounds
+	};
+
+	struct PCGEXTENDEDTOOLKIT_API FVoronoiCell
+	{
+		int32 Site = -1;
+		TArray<FVoronoiCellFace> Faces;
+
+		FORCEINLINE bool IsValid() const { return !Faces.IsEmpty(); }
+	};
+
+	/**
+	 * Voronoi cells clipped against bounds; every cell is closed.
+	 * Vertices are welded across cells so Edges forms a single consistent graph.
+	 */
+	struct PCGEXTENDEDTOOLKIT_API FVoronoiClippedCells
+	{
+		TArray<FVector> Vertices;
+		TArray<FVoronoiCell> Cells; // One per input position
+		TSet<uint64> Edges;         // Unique edges between vertices
+		TSet<uint64> Adjacency;     // Pairs of sites sharing a face
+
+		/** Per-site number of neighboring cells, and whether the cell has a face on the clipping bounds */
+		void GetSiteInfos(TArray<int32>& OutNeighborCounts, TArray<bool>& OutOnBounds) const
+		{
+			OutNeighborCounts.Init(0, Cells.Num());
+			OutOnBounds.Init(false, Cells.Num());
+
+			for (const uint64 Pair : Adjacency)
+			{
+				OutNeighborCounts[PCGEx::H64A(Pair)]++;
+				OutNeighborCounts[PCGEx::H64B(Pair)]++;
+			}
+
+			for (int i = 0; i < Cells.Num(); i++)
+			{
+				for (const FVoronoiCellFace& Face : Cells[i].Faces)
+				{
+					if (Face.Neighbor != -1) { continue; }
+					OutOnBounds[i] = true;
+					break;
+				}
+			}
+		}
+
+		void Reset()
+		{
+			Vertices.Empty();
+			Cells.Empty();
+			Edges.Empty();
+			Adjacency.Empty();
+		}
+	};
+
+	namespace VoronoiClipping
+	{
+		struct FRawFace
+		{
+			TArray<FVector> Points;
+			int32 Neighbor = -1;
+		};
+	}
+
 	class PCGEXTENDEDTOOLKIT_API TVoronoi2
 	{
+		// Staged clipping state
+		TArray<FVector2D> ClipPositions2D;
+		FBox2D ClipBox2D = FBox2D(ForceInit);
+		FQuat ClipProjection = FQuat::Identity;
+		double ClipDepth = 0;
+		double ClipWeldTolerance = 0.01;
+		TArray<int32> ClipOffsets;
+		TArray<int32> ClipNeighbors;
+		TArray<TArray<VoronoiClipping::FRawFace>> RawCells;
+
 	public:
 		TUniquePtr<TDelaunay2> Delaunay;
 		TSet<uint64> VoronoiEdges;
 		TArray<FVector> Circumcenters;
 		TArray<FVector> Centroids;
+		FVoronoiClippedCells ClippedCells;
 
 		bool IsValid = false;
 
@@ -32,9 +109,27 @@ namespace PCGExGeo
 		{
 			Delaunay.Reset();
 			Centroids.Empty();
+			ClippedCells.Reset();
+			RawCells.Empty();
 			IsValid = false;
 		}
 
+		/**
+		 * Compute each position's cell clipped to the projected bounds.
+		 * Cells lie on the projection plane, at the average projected depth of the positions.
+		 */
+		bool ProcessClipped(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const FBox& Bounds, const double WeldTolerance = 0.01);
+
+		/**
+		 * Staged ProcessClipped : after BeginClipped, ClipCells can run over any partition of [0, GetNumClipSites()),
+		 * in parallel, followed by EndClipped.
+		 */
+		bool BeginClipped(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const FBox& Bounds, const double WeldTolerance = 0.01);
+		void ClipCells(const PCGExMT::FScope& Scope);
+		void EndClipped();
+
+		int32 GetNumClipSites() const { return RawCells.Num(); }
+
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
 		{
 			Clear();
@@ -113,12 +208,21 @@ namespace PCGExGeo
 
 	class PCGEXTENDEDTOOLKIT_API TVoronoi3
 	{
+		// Staged clipping state
+		TArrayView<FVector> ClipPositions;
+		FBox ClipBounds = FBox(ForceInit);
+		double ClipWeldTolerance = 0.01;
+		TArray<int32> ClipOffsets;
+		TArray<int32> ClipNeighbors;
+		TArray<TArray<VoronoiClipping::FRawFace>> RawCells;
+
 	public:
 		TUniquePtr<TDelaunay3> Delaunay;
 		TSet<uint64> VoronoiEdges;
 		TSet<int32> VoronoiHull;
 		TArray<FSphere> Circumspheres;
 		TArray<FVector> Centroids;
+		FVoronoiClippedCells ClippedCells;
 
 		bool IsValid = false;
 
@@ -134,9 +238,24 @@ namespace PCGExGeo
 		{
 			Delaunay.Reset();
 			Centroids.Empty();
+			ClippedCells.Reset();
+			RawCells.Empty();
 			IsValid = false;
 		}
 
+		/** Compute each position's cell clipped to the bounds. */
+		bool ProcessClipped(const TArrayView<FVector>& Positions, const FBox& Bounds, const double WeldTolerance = 0.01);
+
+		/**
+		 * Staged ProcessClipped : after BeginClipped, ClipCells can run over any partition of [0, GetNumClipSites()),
+		 * in parallel, followed by EndClipped. Positions must outlive EndClipped.
+		 */
+		bool BeginClipped(const TArrayView<FVector>& Positions, const FBox& Bounds, const double WeldTolerance = 0.01);
+		void ClipCells(const PCGExMT::FScope& Scope);
+		void EndClipped();
+
+		int32 GetNumClipSites() const { return RawCells.Num(); }
+
 		bool Process(const TArrayView<FVector>& Positions)
 		{
 			IsValid = false;
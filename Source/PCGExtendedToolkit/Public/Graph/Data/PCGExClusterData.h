@@ -68,4 +68,19 @@ protected:
 namespace PCGExClusterData
 {
 	TSharedPtr<PCGExCluster::FCluster> TryGetCachedCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO);
+
+	// Persistent cache
+	// Only topology is stored (nodes, links, edges); bounds are recomputed on load, octrees & expanded edges remain lazy.
+	// Entries live in Saved/PCGEx/ClusterCache; loading an entry refreshes its timestamp, and writing one prunes the least recently used
+	// entries until the directory fits within UPCGExGlobalSettings::PersistentClusterCacheMaxSizeMB.
+
+	uint64 ComputePersistentKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO);
+
+	TSharedPtr<PCGExCluster::FCluster> TryLoadPersistentCluster(
+		const uint64 Key, const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO,
+		const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup);
+
+	bool SavePersistentCluster(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InCluster);
+
+	void ClearPersistentCache();
 }
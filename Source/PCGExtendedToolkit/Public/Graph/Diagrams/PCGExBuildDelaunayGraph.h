@@ -107,6 +107,8 @@ namespace PCGExBuildDelaunay
 
 		TSharedPtr<PCGExData::TBuffer<bool>> HullMarkPointWriter;
 
+		TArray<FVector> ActivePositions;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TProcessor(InPointDataFacade)
@@ -114,6 +116,7 @@ namespace PCGExBuildDelaunay
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		void OnSitesExtracted();
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		virtual void CompleteWork() override;
@@ -121,6 +121,8 @@ namespace PCGExBuildDelaunay2D
 
 		TSharedPtr<PCGExData::TBuffer<bool>> HullMarkPointWriter;
 
+		TArray<FVector> ActivePositions;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TProcessor(InPointDataFacade)
@@ -128,6 +130,7 @@ namespace PCGExBuildDelaunay2D
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		void OnSitesExtracted();
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		virtual void CompleteWork() override;
@@ -45,8 +45,12 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	double ExpandBounds = 100;
 
+	/** Output closed cells clipped against the expanded bounds, along with sites carrying cell information. Cell center method & pruning are ignored. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	bool bClipToBounds = false;
+
 	/** Prune points outside bounds */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExCellCenter::Circumcenter"))
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExCellCenter::Circumcenter && !bClipToBounds"))
 	bool bPruneOutOfBounds = false;
 
 	/** Mark points & edges that lie on the hull */
@@ -65,6 +69,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, DisplayName="Cluster Output Settings"))
 	FPCGExGraphBuilderDetails GraphBuilderDetails = FPCGExGraphBuilderDetails(EPCGExMinimalAxis::X);
 
+	/** Write the number of neighboring cells on each site. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteCellNeighborCount = false;
+
+	/** Name of the 'int32' attribute to write the number of neighboring cells to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, EditCondition="bClipToBounds && bWriteCellNeighborCount"))
+	FName CellNeighborCountAttributeName = "CellNeighborCount";
+
+	/** Flag sites whose cell has been clipped by the bounds. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteCellOnBounds = false;
+
+	/** Name of the 'bool' attribute to write whether the cell touches the bounds to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, EditCondition="bClipToBounds && bWriteCellOnBounds"))
+	FName CellOnBoundsAttributeName = "bCellOnBounds";
+
 	// TODO : Output modified/pruned sites to ensure we can find contours even tho the centroid method is not canon
 
 private:
@@ -96,8 +116,12 @@ namespace PCGExBuildVoronoi
 		TUniquePtr<PCGExGeo::TVoronoi3> Voronoi;
 		TSharedPtr<PCGExGraph::FGraphBuilder> GraphBuilder;
 
+		TSharedPtr<PCGExData::FFacade> SiteDataFacade;
+
 		PCGExData::TBuffer<bool>* HullMarkPointWriter = nullptr;
 
+		TArray<FVector> ActivePositions;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TProcessor(InPointDataFacade)
@@ -107,6 +131,8 @@ namespace PCGExBuildVoronoi
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		void OutputClippedCells();
+		void CompileGraph();
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		virtual void CompleteWork() override;
@@ -96,8 +96,12 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	double ExpandBounds = 100;
 
+	/** Output closed cells clipped against the expanded bounds. Cell center method & pruning are ignored. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	bool bClipToBounds = false;
+
 	/** Prune points outside bounds */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExCellCenter::Circumcenter"))
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="Method == EPCGExCellCenter::Circumcenter && !bClipToBounds"))
 	bool bPruneOutOfBounds = false;
 
 	/** Mark points & edges that lie on the hull */
@@ -137,6 +141,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, EditCondition="bOutputSites", ShowOnlyInnerProperties))
 	FPCGExVoronoiSitesOutputDetails SitesOutputDetails;
 
+	/** Write the number of neighboring cells on each site. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteCellNeighborCount = false;
+
+	/** Name of the 'int32' attribute to write the number of neighboring cells to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, EditCondition="bOutputSites && bClipToBounds && bWriteCellNeighborCount"))
+	FName CellNeighborCountAttributeName = "CellNeighborCount";
+
+	/** Flag sites whose cell has been clipped by the bounds. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bWriteCellOnBounds = false;
+
+	/** Name of the 'bool' attribute to write whether the cell touches the bounds to. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Additional Outputs", meta = (PCG_Overridable, EditCondition="bOutputSites && bClipToBounds && bWriteCellOnBounds"))
+	FName CellOnBoundsAttributeName = "bCellOnBounds";
+
 private:
 	friend class FPCGExBuildVoronoiGraph2DElement;
 };
@@ -188,6 +208,8 @@ namespace PCGExBuildVoronoi2D
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		void OutputClippedCells();
+		void CompileGraph();
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		virtual void CompleteWork() override;
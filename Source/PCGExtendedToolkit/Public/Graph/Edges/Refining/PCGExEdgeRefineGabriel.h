@@ -30,20 +30,30 @@ public:
 		const FVector Center = FMath::Lerp(From, To, 0.5);
 		const double SqrDist = FVector::DistSquared(Center, From);
 
-		Cluster->NodeOctree->FindFirstElementWithBoundsTest(
-			FBoxCenterAndExtent(Center, FVector(FMath::Sqrt(SqrDist))), [&](const PCGEx::FIndexedItem& Item)
+		auto TestNode = [&](const int32 NodeIndex)
+		{
+			if (FVector::DistSquared(Center, Cluster->GetPos(NodeIndex)) < SqrDist)
 			{
-				if (FVector::DistSquared(Center, Cluster->GetPos(Item.Index)) < SqrDist)
-				{
-					FPlatformAtomics::InterlockedExchange(&Edge.bValid, ExchangeValue);
-					return false;
-				}
-				return true;
-			});
+				FPlatformAtomics::InterlockedExchange(&Edge.bValid, ExchangeValue);
+				return false;
+			}
+			return true;
+		};
+
+		// On a Delaunay cluster, any point inside the diametral sphere implies one of the adjacent triangles' apexes is too
+		if (bAssumeDelaunay)
+		{
+			ForEachSharedNeighbor(Edge, TestNode);
+			return;
+		}
+
+		Cluster->NodeOctree->FindFirstElementWithBoundsTest(
+			FBoxCenterAndExtent(Center, FVector(FMath::Sqrt(SqrDist))), [&](const PCGEx::FIndexedItem& Item) { return TestNode(Item.Index); });
 	}
 
 	int8 ExchangeValue = 0;
 	bool bInvert = false;
+	bool bAssumeDelaunay = false;
 };
 
 /**
@@ -56,7 +66,7 @@ class UPCGExEdgeRefineGabriel : public UPCGExEdgeRefineInstancedFactory
 
 public:
 	virtual bool GetDefaultEdgeValidity() const override { return !bInvert; }
-	virtual bool WantsNodeOctree() const override { return true; }
+	virtual bool WantsNodeOctree() const override { return !bAssumeDelaunay; }
 
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override
 	{
@@ -64,6 +74,7 @@ public:
 		if (const UPCGExEdgeRefineGabriel* TypedOther = Cast<UPCGExEdgeRefineGabriel>(Other))
 		{
 			bInvert = TypedOther->bInvert;
+			bAssumeDelaunay = TypedOther->bAssumeDelaunay;
 		}
 	}
 
@@ -73,5 +84,13 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bInvert = false;
 
-	PCGEX_CREATE_REFINE_OPERATION(EdgeRefineGabriel, { Operation->bInvert = bInvert; })
+	/** Only test the vertices adjacent to both ends of each edge instead of running a spatial query. Exact and much cheaper on Delaunay clusters, but will keep edges it shouldn't on other inputs. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	bool bAssumeDelaunay = false;
+
+	PCGEX_CREATE_REFINE_OPERATION(
+		EdgeRefineGabriel, {
+		Operation->bInvert = bInvert;
+		Operation->bAssumeDelaunay = bAssumeDelaunay;
+		})
 };
@@ -50,6 +50,12 @@ public:
 	{
 	}
 
+	/** Whole-cluster pass, for refinements that spread their work over task groups on the given manager. Defaults to Process(). */
+	virtual void ProcessAsync(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager)
+	{
+		Process();
+	}
+
 	virtual void ProcessNode(PCGExCluster::FNode& Node)
 	{
 	}
@@ -59,6 +65,24 @@ public:
 	}
 
 protected:
+	/**
+	 * Visit the nodes adjacent to both ends of an edge, which on triangulated clusters are the apexes of its triangle fan.
+	 * Stops as soon as the callback returns false.
+	 */
+	template <typename FunctionType>
+	void ForEachSharedNeighbor(const PCGExGraph::FEdge& Edge, FunctionType&& Func) const
+	{
+		const PCGExCluster::FNode* Start = Cluster->GetEdgeStart(Edge);
+		const PCGExCluster::FNode* End = Cluster->GetEdgeEnd(Edge);
+		if (Start->Num() > End->Num()) { Swap(Start, End); }
+
+		for (const PCGExGraph::FLink Lk : Start->Links)
+		{
+			if (Lk.Node == End->Index || !End->IsAdjacentTo(Lk.Node)) { continue; }
+			if (!Func(Lk.Node)) { return; }
+		}
+	}
+
 	TSharedPtr<PCGExCluster::FCluster> Cluster;
 	TSharedPtr<PCGExHeuristics::FHeuristicsHandler> Heuristics;
 	mutable FRWLock EdgeLock;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Algo/Unique.h"
 
 #include "PCGExEdgeRefineOperation.h"
 #include "Graph/PCGExCluster.h"
@@ -29,72 +30,87 @@ public:
 		MinDot = bUseMinAngle ? PCGExMath::DegreesToDot(MinAngle) : 1;
 		MaxDot = bUseMaxAngle ? PCGExMath::DegreesToDot(MaxAngle) : -1;
 		ToleranceSquared = FMath::Square(Tolerance);
-		Cluster->GetBoundedEdges(true); // Let's hope it was cached ^_^
 	}
 
-	virtual void ProcessEdge(PCGExGraph::FEdge& Edge) override
+	virtual void ProcessAsync(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override
 	{
-		const double Length = Cluster->GetDistSquared(Edge);
+		const TArray<PCGExGraph::FEdge>& Edges = *Cluster->Edges;
+		const int32 NumEdges = Edges.Num();
 
-		const FVector A1 = Cluster->GetStartPos(Edge);
-		const FVector B1 = Cluster->GetEndPos(Edge);
+		if (NumEdges < 2) { return; }
 
-		auto ProcessOverlap = [&](const PCGEx::FIndexedItem& Item)
-		{
-			//if (!Edge.bValid) { return false; }
+		AsyncManager = InAsyncManager;
 
-			const PCGExGraph::FEdge& OtherEdge = *Cluster->GetEdge(Item.Index);
+		// Broad phase : edges are rasterized into a sparse grid sized after the average edge length,
+		// so long diagonal edges only ever meet the edges that run along them.
 
-			if (Edge.Index == OtherEdge.Index ||
-				Edge.Start == OtherEdge.Start || Edge.Start == OtherEdge.End ||
-				Edge.End == OtherEdge.End || Edge.End == OtherEdge.Start) { return true; }
+		double TotalLength = 0;
+		for (const PCGExGraph::FEdge& Edge : Edges) { TotalLength += Cluster->GetDist(Edge); }
 
+		Origin = Cluster->Bounds.Min - FVector(Tolerance);
+		CellSize = FMath::Max(FMath::Max3(TotalLength / NumEdges, Tolerance * 2, (Cluster->Bounds.GetSize().GetMax() + Tolerance * 2) / static_cast<double>(MaxCellCoord)), UE_DOUBLE_KINDA_SMALL_NUMBER);
+		InvCellSize = 1 / CellSize;
 
-			if (bUseMinAngle || bUseMaxAngle)
-			{
-				const double Dot = FMath::Abs(FVector::DotProduct(Cluster->GetEdgeDir(Edge), Cluster->GetEdgeDir(OtherEdge)));
-				if (!(Dot >= MaxDot && Dot <= MinDot)) { return true; }
-			}
-
-			const double OtherLength = Cluster->GetDistSquared(OtherEdge);
+		PCGEx::InitArray(CellOffsets, NumEdges + 1);
+		CellOffsets[0] = 0;
 
-			FVector A;
-			FVector B;
-			if (Cluster->EdgeDistToEdgeSquared(&Edge, &OtherEdge, A, B) >= ToleranceSquared) { return true; }
+		PCGEX_ASYNC_GROUP_CHKD_VOID(InAsyncManager, CountCellsTask)
 
-			const FVector A2 = Cluster->GetStartPos(OtherEdge);
-			const FVector B2 = Cluster->GetEndPos(OtherEdge);
-
-			if (A == A1 || A == B1 || A == A2 || A == B2 ||
-				B == A2 || B == B2 || B == A1 || B == B1) { return true; }
-
-			// Overlap!
-			if (Keep == EPCGExEdgeOverlapPick::Longest)
+		CountCellsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
-				if (OtherLength > Length)
-				{
-					FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
-					return false;
-				}
-			}
-			else
+				PCGEX_ASYNC_THIS
+				This->FillCells();
+			};
+
+		CountCellsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 			{
-				if (OtherLength < Length)
+				PCGEX_ASYNC_THIS
+				const TArray<PCGExGraph::FEdge>& ScopeEdges = *This->Cluster->Edges;
+				PCGEX_SCOPE_LOOP(i)
 				{
-					FPlatformAtomics::InterlockedExchange(&Edge.bValid, 0);
-					return false;
+					FEdgeCells Cells;
+					This->GatherCells(ScopeEdges[i], Cells);
+					This->CellOffsets[i + 1] = Cells.Num();
 				}
-			}
-
-			return true;
-		};
+			};
 
-		(void)Cluster->GetEdgeOctree()->FindFirstElementWithBoundsTest(
-			(Cluster->BoundedEdges->GetData() + Edge.Index)->Bounds.GetBox(),
-			ProcessOverlap);
+		CountCellsTask->StartSubLoops(NumEdges, GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
 	}
 
-	//virtual void Process() override;
+	void ProcessPair(PCGExGraph::FEdge& Edge, PCGExGraph::FEdge& OtherEdge) const
+	{
+		if (Edge.Start == OtherEdge.Start || Edge.Start == OtherEdge.End ||
+			Edge.End == OtherEdge.End || Edge.End == OtherEdge.Start) { return; }
+
+		if (bUseMinAngle || bUseMaxAngle)
+		{
+			const double Dot = FMath::Abs(FVector::DotProduct(Cluster->GetEdgeDir(Edge), Cluster->GetEdgeDir(OtherEdge)));
+			if (!(Dot >= MaxDot && Dot <= MinDot)) { return; }
+		}
+
+		FVector A;
+		FVector B;
+		if (Cluster->EdgeDistToEdgeSquared(&Edge, &OtherEdge, A, B) >= ToleranceSquared) { return; }
+
+		const FVector A1 = Cluster->GetStartPos(Edge);
+		const FVector B1 = Cluster->GetEndPos(Edge);
+		const FVector A2 = Cluster->GetStartPos(OtherEdge);
+		const FVector B2 = Cluster->GetEndPos(OtherEdge);
+
+		if (A == A1 || A == B1 || A == A2 || A == B2 ||
+			B == A2 || B == B2 || B == A1 || B == B1) { return; }
+
+		const double Length = Cluster->GetDistSquared(Edge);
+		const double OtherLength = Cluster->GetDistSquared(OtherEdge);
+
+		if (Length == OtherLength) { return; }
+
+		// Overlap! Only the losing edge of the pair goes away
+		PCGExGraph::FEdge& Loser = (Length < OtherLength) == (Keep == EPCGExEdgeOverlapPick::Longest) ? Edge : OtherEdge;
+		FPlatformAtomics::InterlockedExchange(&Loser.bValid, 0);
+	}
 
 	EPCGExEdgeOverlapPick Keep = EPCGExEdgeOverlapPick::Longest;
 
@@ -108,6 +124,191 @@ public:
 	bool bUseMaxAngle = true;
 	double MaxAngle = 90;
 	double MaxDot = -1;
+
+protected:
+	static constexpr int32 CellBits = 21;
+	static constexpr int32 MaxCellCoord = (1 << CellBits) - 2;
+
+	using FEdgeCells = TArray<uint64, TInlineAllocator<16>>;
+
+	struct FCellEdge
+	{
+		uint64 Cell = 0;
+		int32 Edge = -1;
+
+		FORCEINLINE bool operator<(const FCellEdge& Other) const { return Cell == Other.Cell ? Edge < Other.Edge : Cell < Other.Cell; }
+	};
+
+	double CellSize = 1;
+	double InvCellSize = 1;
+
+	FORCEINLINE uint64 GetCellKey(const int32 X, const int32 Y, const int32 Z) const
+	{
+		return static_cast<uint64>(X) << (CellBits * 2) | static_cast<uint64>(Y) << CellBits | static_cast<uint64>(Z);
+	}
+
+	FORCEINLINE FIntVector GetCell(const FVector& Position) const
+	{
+		return FIntVector(
+			FMath::Clamp(FMath::FloorToInt32(Position.X * InvCellSize), 0, MaxCellCoord),
+			FMath::Clamp(FMath::FloorToInt32(Position.Y * InvCellSize), 0, MaxCellCoord),
+			FMath::Clamp(FMath::FloorToInt32(Position.Z * InvCellSize), 0, MaxCellCoord));
+	}
+
+	TWeakPtr<PCGExMT::FTaskManager> AsyncManager;
+
+	FVector Origin = FVector::ZeroVector;
+	TArray<int32> CellOffsets;
+	TArray<uint64> EdgeCells; // Each edge' sorted cells, to find the first cell a pair shares
+	TArray<FCellEdge> CellEdges;
+
+	void FillCells()
+	{
+		const int32 NumEdges = Cluster->Edges->Num();
+		for (int i = 0; i < NumEdges; i++) { CellOffsets[i + 1] += CellOffsets[i]; }
+
+		PCGEx::InitArray(EdgeCells, CellOffsets[NumEdges]);
+		PCGEx::InitArray(CellEdges, CellOffsets[NumEdges]);
+
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, FillCellsTask)
+
+		FillCellsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->SortCells();
+			};
+
+		FillCellsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				const TArray<PCGExGraph::FEdge>& ScopeEdges = *This->Cluster->Edges;
+				PCGEX_SCOPE_LOOP(i)
+				{
+					FEdgeCells Cells;
+					This->GatherCells(ScopeEdges[i], Cells);
+
+					int32 WriteIndex = This->CellOffsets[i];
+					for (const uint64 Cell : Cells)
+					{
+						This->EdgeCells[WriteIndex] = Cell;
+						This->CellEdges[WriteIndex] = FCellEdge{Cell, i};
+						WriteIndex++;
+					}
+				}
+			};
+
+		FillCellsTask->StartSubLoops(NumEdges, GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
+	}
+
+	void SortCells()
+	{
+		PCGExMT::ParallelSort(
+			AsyncManager.Pin(), CellEdges, TLess<FCellEdge>(),
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->ProcessCells();
+			});
+	}
+
+	// Narrow phase : each pair is tested once, in the first cell both edges share
+	void ProcessCells()
+	{
+		const TSharedPtr<PCGExMT::FTaskManager> Manager = AsyncManager.Pin();
+		PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, ProcessCellsTask)
+
+		ProcessCellsTask->OnCompleteCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CellOffsets.Empty();
+				This->EdgeCells.Empty();
+				This->CellEdges.Empty();
+			};
+
+		ProcessCellsTask->OnSubLoopStartCallback =
+			[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				PCGEX_SCOPE_LOOP(i) { This->ProcessCell(i); }
+			};
+
+		ProcessCellsTask->StartSubLoops(CellEdges.Num(), GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize());
+	}
+
+	// Tests the pairs of a cell from the first entry of its run; the other entries of the run are no-ops
+	void ProcessCell(const int32 CellStart)
+	{
+		const int32 NumCellEdges = CellEdges.Num();
+		const uint64 Cell = CellEdges[CellStart].Cell;
+		if (CellStart > 0 && CellEdges[CellStart - 1].Cell == Cell) { return; }
+
+		int32 End = CellStart + 1;
+		while (End < NumCellEdges && CellEdges[End].Cell == Cell) { End++; }
+
+		TArray<PCGExGraph::FEdge>& Edges = *Cluster->Edges;
+		for (int a = CellStart; a < End; a++)
+		{
+			const int32 EdgeA = CellEdges[a].Edge;
+			for (int b = a + 1; b < End; b++)
+			{
+				const int32 EdgeB = CellEdges[b].Edge;
+				if (!IsFirstSharedCell(EdgeA, EdgeB, Cell)) { continue; }
+				ProcessPair(Edges[EdgeA], Edges[EdgeB]);
+			}
+		}
+	}
+
+	// Conservative rasterization : the edge is split into cell-sized steps, each step covering the cells its tolerance-expanded bounds touch
+	void GatherCells(const PCGExGraph::FEdge& Edge, FEdgeCells& OutCells) const
+	{
+		const FVector From = Cluster->GetStartPos(Edge) - Origin;
+		const FVector To = Cluster->GetEndPos(Edge) - Origin;
+		const int32 NumSteps = FMath::Max(1, FMath::CeilToInt32(FVector::Dist(From, To) * InvCellSize));
+
+		FVector StepStart = From;
+		for (int s = 1; s <= NumSteps; s++)
+		{
+			const FVector StepEnd = FMath::Lerp(From, To, static_cast<double>(s) / NumSteps);
+
+			const FIntVector Min = GetCell(StepStart.ComponentMin(StepEnd) - FVector(Tolerance));
+			const FIntVector Max = GetCell(StepStart.ComponentMax(StepEnd) + FVector(Tolerance));
+
+			for (int32 X = Min.X; X <= Max.X; X++)
+			{
+				for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+				{
+					for (int32 Z = Min.Z; Z <= Max.Z; Z++) { OutCells.Add(GetCellKey(X, Y, Z)); }
+				}
+			}
+
+			StepStart = StepEnd;
+		}
+
+		OutCells.Sort();
+		OutCells.SetNum(Algo::Unique(OutCells));
+	}
+
+	// Whether InCell, which both edges share, is the lowest cell they share
+	bool IsFirstSharedCell(const int32 EdgeA, const int32 EdgeB, const uint64 InCell) const
+	{
+		const uint64* A = EdgeCells.GetData() + CellOffsets[EdgeA];
+		const uint64* B = EdgeCells.GetData() + CellOffsets[EdgeB];
+		const uint64* EndA = EdgeCells.GetData() + CellOffsets[EdgeA + 1];
+		const uint64* EndB = EdgeCells.GetData() + CellOffsets[EdgeB + 1];
+
+		while (A < EndA && B < EndB)
+		{
+			if (*A == *B) { return *A == InCell; }
+			if (*A < *B) { ++A; }
+			else { ++B; }
+		}
+
+		return false;
+	}
 };
 
 /**
@@ -119,8 +320,6 @@ class UPCGExEdgeRemoveOverlap : public UPCGExEdgeRefineInstancedFactory
 	GENERATED_BODY()
 
 public:
-	virtual bool WantsIndividualEdgeProcessing() const override { return true; }
-	virtual bool WantsEdgeOctree() const override { return true; }
 
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override
 	{
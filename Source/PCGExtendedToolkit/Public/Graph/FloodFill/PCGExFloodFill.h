@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExScopedContainers.h"
 #include "Data/Blending/PCGExBlendOpsManager.h"
 
 #include "Graph/PCGExEdgesProcessor.h"
@@ -112,6 +113,10 @@ namespace PCGExFloodFill
 		TSet<int32> Visited;
 		// use map hash lookup to reduce memory overhead of a shared map + thread safety yay
 
+		TArray<FCandidate> ProbeBatch;
+		TArray<FCandidate> Frontier;
+		int32 FirstFrontierCapture = 0;
+
 		int32 MaxDepth = 0;
 		double MaxDistance = 0;
 
@@ -140,6 +145,24 @@ namespace PCGExFloodFill
 		void Grow();
 		void PostGrow();
 
+		// Frontier growth is split in three passes that must each complete for all diffusions before the next one starts :
+		// claim every candidate within the current priority bucket, capture the claims that were won, then probe all new captures as a single batch
+		void ClaimFrontier();
+		void CaptureFrontier();
+		void ProbeFrontier();
+
+		FORCEINLINE int64 GetClaimKey(const FCandidate& Candidate) const { return (static_cast<int64>(Candidate.Depth) << 32) | SeedIndex; }
+
+	protected:
+		bool MarkVisited(const int32 NodeIndex);
+		void GatherNeighbors(const FCandidate& From);
+		void CommitProbeBatch();
+		void SortCandidates();
+		double GetPriority(const FCandidate& Candidate) const;
+		void ScoreCandidates(TArray<FCandidate>& InBatch) const;
+
+	public:
+
 		void Diffuse(
 			const TSharedPtr<PCGExData::FFacade>& InVtxFacade,
 			const TSharedPtr<PCGExDataBlending::FBlendOpsManager>& InBlendOps,
@@ -180,6 +203,18 @@ namespace PCGExFloodFill
 		bool bUseGlobalScore = false;
 		bool bUsePreviousScore = false;
 
+		// Frontier growth; contested nodes go to the lowest claim key, i.e the shallowest candidate then the lowest seed index
+		bool bUseFrontier = false;
+		TArray<int64> FrontierClaims;
+		double FrontierBucketWidth = 1;
+
+		void EnableFrontier(const double InBucketWidth);
+
+		void Claim(const int32 NodeIndex, const int64 Key);
+		FORCEINLINE bool IsClaimedBy(const int32 NodeIndex, const int64 Key) const { return FPlatformAtomics::AtomicRead(FrontierClaims.GetData() + NodeIndex) == Key; }
+		FORCEINLINE void ReleaseClaim(const int32 NodeIndex) { FPlatformAtomics::AtomicStore(FrontierClaims.GetData() + NodeIndex, MAX_int64); }
+		FORCEINLINE bool IsCaptured(const int32 PointIndex) const { return FPlatformAtomics::AtomicRead(InfluencesCount->GetData() + PointIndex) != 0; }
+
 		FORCEINLINE bool IsValidHandler() const { return bIsValidHandler; }
 		FORCEINLINE int32 GetNumDiffusions() const { return NumDiffusions; }
 
@@ -197,6 +232,7 @@ namespace PCGExFloodFill
 
 		bool PrepareForDiffusions(const TArray<TSharedPtr<FDiffusion>>& Diffusions, const FPCGExFloodFillFlowDetails& Details);
 
+		bool IsValidCapture(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidProbe(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidCandidate(const FDiffusion* Diffusion, const FCandidate& From, const FCandidate& Candidate);
@@ -33,6 +33,7 @@ enum class EPCGExFloodFillProcessing : uint8
 {
 	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration."),
 	Sequence = 1 UMETA(DisplayName = "Sequential", ToolTip="Diffuse each vtx until it stops before moving to the next one, and so on."),
+	Frontier = 2 UMETA(DisplayName = "Frontier", ToolTip="Diffuse each vtx by whole priority buckets at a time. Contested vtx go to the shallowest diffusion, then the lowest seed index. Much faster on large clusters."),
 };
 
 UENUM()
@@ -105,6 +106,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	EPCGExFloodFillProcessing Processing = EPCGExFloodFillProcessing::Parallel;
 
+	/** Size of the priority buckets captured at once by each frontier step. Priority is either the candidate score or depth, depending on diffusion priority. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, EditCondition="Processing == EPCGExFloodFillProcessing::Frontier", EditConditionHides, ClampMin=0.001))
+	double FrontierBucketWidth = 1;
+
 	/** Diffusion settings */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	FPCGExFloodFillFlowDetails Diffusion;
@@ -230,6 +235,11 @@ namespace PCGExClusterDiffusion
 
 		int32 ExpectedPathCount = 0;
 
+		// Frontier growth runs claim, capture & probe as separate parallel passes, once per wave
+		int32 FrontierPass = 0;
+		int32 FrontierWave = 0;
+		int32 NumFrontierWaves = 0;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
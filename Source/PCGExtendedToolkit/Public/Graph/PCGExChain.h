@@ -9,7 +9,7 @@
 
 namespace PCGExCluster
 {
-	class PCGEXTENDEDTOOLKIT_API FNodeChain : public TSharedFromThis<FNodeChain>
+	class PCGEXTENDEDTOOLKIT_API FNodeChain
 	{
 	public:
 		FLink Seed;
@@ -18,8 +18,9 @@ namespace PCGExCluster
 		bool bIsClosedLoop = false;
 		bool bIsLeaf = false;
 
-		uint64 UniqueHash = 0;
-		TArray<FLink> Links; // {Seed} [Edge <- Node][Edge <- Node] // Seed hold edge index that wrap if closed loop.
+		TConstArrayView<FLink> Links; // {Seed} [Edge <- Node][Edge <- Node] // Seed hold edge index that wrap if closed loop. Span of FNodeChainBuilder::ChainLinks.
+
+		FNodeChain() = default;
 
 		explicit FNodeChain(const FLink InSeed)
 			: Seed(InSeed)
@@ -27,9 +28,7 @@ namespace PCGExCluster
 		}
 
 		~FNodeChain() = default;
-		void FixUniqueHash();
 
-		void BuildChain(const TSharedRef<FCluster>& Cluster, const TSharedPtr<TArray<int8>>& Breakpoints);
 		void Dump(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
 		void DumpReduced(const TSharedRef<FCluster>& Cluster, const TSharedPtr<PCGExGraph::FGraph>& Graph, const bool bAddMetadata) const;
 
@@ -37,7 +36,7 @@ namespace PCGExCluster
 		FVector GetLastEdgeDir(const TSharedPtr<FCluster>& Cluster) const;
 		FVector GetEdgeDir(const TSharedPtr<FCluster>& Cluster, const bool bFirst) const;
 
-		int32 GetNodes(const TSharedPtr<FCluster>& Cluster, TArray<int32>& OutNodes, bool bReverse);
+		int32 GetNodes(const TSharedPtr<FCluster>& Cluster, TArray<int32>& OutNodes, bool bReverse) const;
 	};
 
 	class PCGEXTENDEDTOOLKIT_API FNodeChainBuilder : public TSharedFromThis<FNodeChainBuilder>
@@ -45,7 +44,8 @@ namespace PCGExCluster
 	public:
 		TSharedRef<FCluster> Cluster;
 		TSharedPtr<TArray<int8>> Breakpoints;
-		TArray<TSharedPtr<FNodeChain>> Chains;
+		TArray<FNodeChain> Chains;
+		TArray<FLink> ChainLinks; // Links of all chains, back to back
 
 		FNodeChainBuilder(const TSharedRef<FCluster>& InCluster)
 			: Cluster(InCluster)
@@ -56,7 +56,21 @@ namespace PCGExCluster
 		bool CompileLeavesOnly(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 
 	protected:
+		struct FScopedChains
+		{
+			TArray<FNodeChain> Chains;
+			TArray<int32> NumLinks;
+			TArray<FLink> Links;
+		};
+
+		bool bLeavesOnly = false;
+		TArray<FLink> Seeds;
+		TArray<FScopedChains> ScopedChains;
+
+		FORCEINLINE bool IsBreaking(const FNode* Node) const { return !Node->IsBinary() || (Breakpoints && (*Breakpoints)[Node->PointIndex]); }
+
 		bool DispatchTasks(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
-		void Dedupe();
+		void BuildChains(const PCGExMT::FScope& Scope);
+		void CompactChains();
 	};
 }
@@ -182,6 +182,12 @@ namespace PCGExCluster
 		void WillModifyVtxIO(const bool bClearOwned = false);
 		void WillModifyVtxPositions(const bool bClearOwned = false);
 
+		/**
+		 * Create a lightweight instance of this cluster, bound to a transformed copy of its vtx & edges.
+		 * Topology is shared; only bounds and existing octrees are rebuilt from the copy' output positions.
+		 */
+		TSharedRef<FCluster> MakeInstance(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO);
+
 		~FCluster();
 
 		bool BuildFrom(
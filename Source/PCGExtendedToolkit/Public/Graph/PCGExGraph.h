@@ -153,6 +153,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExGraphBuilderDetails
 	bool WantsClusters() const;
 
 	bool IsValid(const TSharedPtr<PCGExGraph::FSubGraph>& InSubgraph) const;
+	bool IsValid(const int32 NumVtx, const int32 NumEdges) const;
 };
 
 namespace PCGExGraph
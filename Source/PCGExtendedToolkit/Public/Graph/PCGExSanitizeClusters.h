@@ -57,6 +57,24 @@ namespace PCGExSanitizeClusters
 {
 	class FProcessor final : public PCGExClusterMT::TProcessor<FPCGExSanitizeClustersContext, UPCGExSanitizeClustersSettings>
 	{
+		friend class FBatch;
+
+	protected:
+		TArray<PCGExGraph::FEdge> IndexedEdges;
+		int32 NumClusterVtx = 0;
+		bool bIsClean = false;
+
+		// Integrity check state, released once the check resolves
+		TArray<uint64> EdgeKeys;
+		TArray<int32> Endpoints;
+		int8 bIntegrityValid = 1;
+
+		// Shared by all the edge sets of the batch
+		TArray<int32>* VtxDegrees = nullptr;
+		TArray<int32>* VtxOwners = nullptr;
+
+		TSharedPtr<PCGExData::TBuffer<double>> EdgeLength;
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -67,10 +85,36 @@ namespace PCGExSanitizeClusters
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+
+		/**
+		 * Starts checking whether the edges already form a single, duplicate-free cluster whose vtx belong to no other cluster.
+		 * Runs as chained task groups; bIsClean holds the result once the async manager is done.
+		 */
+		bool StartIntegrityCheck();
+
+	protected:
+		void ClaimEdges(const PCGExMT::FScope& Scope);
+		void CheckDuplicateEdges();
+		void ScanSortedEdgeKeys();
+		void CheckConnectivity();
+		void RemapEdges();
+		void FindComponents();
+
+	public:
+		virtual void CompleteWork() override;
+		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
+		virtual void OnRangeProcessingComplete() override;
+		virtual void Output() override;
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
 	{
+		TArray<int32> VtxDegrees;
+		TArray<int32> VtxOwners;
+
+		bool bIsClean = false;
+		int8 bDegreesMatch = 1;
+
 	public:
 		FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, const TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges):
 			TBatch(InContext, InVtx, InEdges)
@@ -78,7 +122,14 @@ namespace PCGExSanitizeClusters
 			this->bRequiresGraphBuilder = true;
 		}
 
+		virtual void Process() override;
+		virtual bool PrepareSingle(const TSharedPtr<FProcessor>& ClusterProcessor) override;
+
+		/** Whether every edge set passed its integrity check; vtx degrees are checked separately, on task groups */
+		bool AreProcessorsClean();
+
 		virtual void CompleteWork() override;
+		void Rebuild();
 		virtual void Output() override;
 	};
 }
@@ -39,6 +39,14 @@ struct FPCGExHeuristicConfigFeedback : public FPCGExHeuristicConfigBase
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bGlobalFeedback = false;
 
+	/** If enabled, global feedback is applied in waves : queries within a wave run in parallel against a frozen feedback snapshot, and their feedback is committed before the next wave starts. Parallel & deterministic, at the cost of feedback granularity. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bGlobalFeedback"))
+	bool bBatchSynchronous = false;
+
+	/** Number of queries per wave. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="bGlobalFeedback && bBatchSynchronous", ClampMin=1))
+	int32 BatchSize = 64;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bAffectAllConnectedEdges = true;
@@ -49,15 +57,28 @@ struct FPCGExHeuristicConfigFeedback : public FPCGExHeuristicConfigBase
  */
 class FPCGExHeuristicFeedback : public FPCGExHeuristicOperation
 {
-	mutable FRWLock FeedbackLock;
-	TMap<int32, uint32> NodeFeedbackNum;
-	TMap<int32, uint32> EdgeFeedbackNum;
+	// Global feedback : flat per-node/per-edge visit counts, sized from the cluster & updated atomically
+	TArray<int32> NodeFeedbackNum;
+	TArray<int32> EdgeFeedbackNum;
+
+	// Local feedback lives for a single query and only touches the plotted path, so it stays sparse
+	TMap<int32, int32> LocalNodeFeedbackNum;
+	TMap<int32, int32> LocalEdgeFeedbackNum;
+
+	// Batch-synchronous feedback is accumulated here, and only becomes visible once committed
+	TArray<int32> PendingNodeFeedbackNum;
+	TArray<int32> PendingEdgeFeedbackNum;
 
 public:
 	double NodeScale = 1;
 	double EdgeScale = 1;
 	bool bBleed = true;
 	bool bBinary = false;
+	bool bGlobal = false;
+	bool bBatchSynchronous = false;
+	int32 BatchSize = 64;
+
+	virtual void PrepareForCluster(const TSharedPtr<const PCGExCluster::FCluster>& InCluster) override;
 
 	virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
@@ -75,6 +96,54 @@ public:
 	void FeedbackPointScore(const PCGExCluster::FNode& Node);
 
 	void FeedbackScore(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge);
+
+	// Make pending batch-synchronous feedback visible to subsequent queries
+	void CommitFeedback();
+
+protected:
+	FORCEINLINE int32 GetNodeFeedback(const int32 NodeIndex) const
+	{
+		if (!bGlobal)
+		{
+			const int32* N = LocalNodeFeedbackNum.Find(NodeIndex);
+			return N ? *N : 0;
+		}
+
+		return FPlatformAtomics::AtomicRead_Relaxed(&NodeFeedbackNum[NodeIndex]);
+	}
+
+	FORCEINLINE int32 GetEdgeFeedback(const int32 EdgeIndex) const
+	{
+		if (!bGlobal)
+		{
+			const int32* E = LocalEdgeFeedbackNum.Find(EdgeIndex);
+			return E ? *E : 0;
+		}
+
+		return FPlatformAtomics::AtomicRead_Relaxed(&EdgeFeedbackNum[EdgeIndex]);
+	}
+
+	FORCEINLINE void AddNodeFeedback(const int32 NodeIndex)
+	{
+		if (!bGlobal)
+		{
+			LocalNodeFeedbackNum.FindOrAdd(NodeIndex, 0)++;
+			return;
+		}
+
+		FPlatformAtomics::InterlockedIncrement(&(bBatchSynchronous ? PendingNodeFeedbackNum : NodeFeedbackNum)[NodeIndex]);
+	}
+
+	FORCEINLINE void AddEdgeFeedback(const int32 EdgeIndex)
+	{
+		if (!bGlobal)
+		{
+			LocalEdgeFeedbackNum.FindOrAdd(EdgeIndex, 0)++;
+			return;
+		}
+
+		FPlatformAtomics::InterlockedIncrement(&(bBatchSynchronous ? PendingEdgeFeedbackNum : EdgeFeedbackNum)[EdgeIndex]);
+	}
 };
 
 ////
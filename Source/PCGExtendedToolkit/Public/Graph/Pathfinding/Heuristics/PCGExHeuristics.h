@@ -121,6 +121,10 @@ namespace PCGExHeuristics
 		void FeedbackPointScore(const PCGExCluster::FNode& Node);
 		void FeedbackScore(const PCGExCluster::FNode& Node, const PCGExGraph::FEdge& Edge);
 
+		// Wave size if every global feedback is batch-synchronous, 0 if global feedback requires serial queries
+		int32 GetFeedbackBatchSize() const;
+		void CommitFeedback();
+
 		FVector GetSeedUVW() const;
 		FVector GetGoalUVW() const;
 
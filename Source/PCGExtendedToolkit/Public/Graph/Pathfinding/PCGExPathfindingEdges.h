@@ -155,5 +155,7 @@ namespace PCGExPathfindingEdge
 		TSharedPtr<FPCGExSearchOperation> SearchOperation;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		void StartQueryWave(const int32 WaveStart, const int32 WaveSize);
+		void ResolveQuery(const int32 Index);
 	};
 }
@@ -90,6 +90,7 @@ namespace PCGExPointFilter
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 		virtual bool Test(const int32 PointIndex) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const override;
 
 		virtual ~FBitmaskFilter() override
 		{
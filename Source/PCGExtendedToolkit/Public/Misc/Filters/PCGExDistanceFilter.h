@@ -121,6 +121,7 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 		virtual bool Test(const int32 PointIndex) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+		virtual void TestScope(const PCGExMT::FScope& Scope, const TArrayView<int8> InOutMask) const override;
 
 		virtual ~FDistanceFilter() override
 		{
@@ -10,6 +10,7 @@
 #include "Data/PCGExPointFilter.h"
 #include "PCGExPointsProcessor.h"
 #include "PCGExSplineInclusionFilter.h"
+#include "Geometry/PCGExGeoGrid.h"
 
 
 #include "Paths/PCGExPaths.h"
@@ -111,6 +112,8 @@ public:
 
 	TSharedPtr<TArray<TSharedPtr<FPCGSplineStruct>>> Splines;
 	TSharedPtr<TArray<TArray<FVector2D>>> Polygons;
+	TSharedPtr<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>> PolygonGrids;
+	TSharedPtr<TArray<TSharedPtr<PCGExGeo::FSegmentGrid2D>>> SegmentGrids; // Only valid for linear paths, used to skip closest-point queries on far away paths
 	TSharedPtr<PCGEx::FIndexedItemOctree> Octree;
 
 	virtual bool Init(FPCGExContext* InContext) override;
@@ -132,6 +135,8 @@ namespace PCGExPointFilter
 		{
 			Splines = TypedFilterFactory->Splines;
 			Polygons = TypedFilterFactory->Polygons;
+			PolygonGrids = TypedFilterFactory->PolygonGrids;
+			SegmentGrids = TypedFilterFactory->SegmentGrids;
 			Octree = TypedFilterFactory->Octree;
 		}
 
@@ -139,6 +144,8 @@ namespace PCGExPointFilter
 
 		TSharedPtr<TArray<TSharedPtr<FPCGSplineStruct>>> Splines;
 		TSharedPtr<TArray<TArray<FVector2D>>> Polygons;
+		TSharedPtr<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>> PolygonGrids;
+		TSharedPtr<TArray<TSharedPtr<PCGExGeo::FSegmentGrid2D>>> SegmentGrids;
 		TSharedPtr<PCGEx::FIndexedItemOctree> Octree;
 
 		double ToleranceSquared = MAX_dbl;
@@ -159,6 +166,8 @@ namespace PCGExPointFilter
 		void UpdateInclusionClosest(const FVector& Pos, const int32 TargetIndex, ESplineCheckFlags& OutFlags, double& OutClosestDist) const;
 		void UpdateInclusion(const FVector& Pos, const int32 TargetIndex, ESplineCheckFlags& OutFlags, int32& OutInclusionsCount) const;
 
+		FORCEINLINE bool IsInsidePolygon(const FVector& Pos, const int32 TargetIndex) const { return (PolygonGrids->GetData() + TargetIndex)->Get()->IsInside(FVector2D(Pos)); }
+
 		virtual ~FPathInclusionFilter() override
 		{
 		}
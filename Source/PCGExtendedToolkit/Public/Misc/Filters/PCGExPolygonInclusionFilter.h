@@ -9,6 +9,7 @@
 
 #include "Data/PCGExPointFilter.h"
 #include "PCGExPointsProcessor.h"
+#include "Geometry/PCGExGeoGrid.h"
 
 
 #include "PCGExPolygonInclusionFilter.generated.h"
@@ -67,6 +68,7 @@ public:
 	virtual bool SupportsProxyEvaluation() const override { return true; } // TODO Change this one we support per-point tolerance from attribute
 
 	TSharedPtr<TArray<TSharedPtr<TArray<FVector2D>>>> Polygons;
+	TSharedPtr<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>> Grids;
 	TSharedPtr<PCGEx::FIndexedItemOctree> Octree;
 
 	virtual bool Init(FPCGExContext* InContext) override;
@@ -87,12 +89,14 @@ namespace PCGExPointFilter
 			: ISimpleFilter(InFactory), TypedFilterFactory(InFactory)
 		{
 			Polygons = TypedFilterFactory->Polygons;
+			Grids = TypedFilterFactory->Grids;
 			Octree = TypedFilterFactory->Octree;
 		}
 
 		const TObjectPtr<const UPCGExPolygonInclusionFilterFactory> TypedFilterFactory;
 
 		TSharedPtr<TArray<TSharedPtr<TArray<FVector2D>>>> Polygons;
+		TSharedPtr<TArray<TSharedPtr<PCGExGeo::FPolygonInclusionGrid>>> Grids;
 		TSharedPtr<PCGEx::FIndexedItemOctree> Octree;
 
 		TConstPCGValueRange<FTransform> InTransforms;
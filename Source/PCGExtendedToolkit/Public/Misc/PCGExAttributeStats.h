@@ -19,6 +19,13 @@ enum class EPCGExStatsOutputToPoints : uint8
 	Suffix = 2 UMETA(DisplayName = "Suffix", ToolTip="Uss specified name as a suffix to the attribute' name"),
 };
 
+UENUM()
+enum class EPCGExStatsUniqueMode : uint8
+{
+	Exact       = 0 UMETA(DisplayName = "Exact", ToolTip="Track every value with its count. Exact, but memory grows with the number of different values."),
+	Approximate = 1 UMETA(DisplayName = "Approximate", ToolTip="Estimate different values with HyperLogLog sketches & quantiles with a t-digest. Constant memory per scope."),
+};
+
 UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Misc", meta=(PCGExNodeLibraryDoc="metadata/attribute-stats"))
 class UPCGExAttributeStatsSettings : public UPCGExPointsProcessorSettings
 {
@@ -51,6 +58,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExNameFiltersDetails Filters = FPCGExNameFiltersDetails(true);
 
+	/** How values are counted. Approximate mode cannot count values that appear exactly once; those outputs will be -1. Per-unique-values stats always use exact tracking. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
+	EPCGExStatsUniqueMode UniqueValuesMode = EPCGExStatsUniqueMode::Exact;
+
+	/** HyperLogLog precision; uses 2^N registers per sketch. Relative error is roughly 1.04 / sqrt(2^N). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="UniqueValuesMode == EPCGExStatsUniqueMode::Approximate", EditConditionHides, ClampMin=4, ClampMax=16))
+	int32 SketchPrecision = 12;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	bool bOutputPerUniqueValuesStats = false;
@@ -119,6 +134,26 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Average", EditCondition="bOutputAverageValue"))
 	FName AverageValueAttributeName = FName(TEXT("Average"));
 
+	/** Median of numeric attributes. Non-numeric attributes output their default value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputMedianValue = false;
+
+	/** */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Median", EditCondition="bOutputMedianValue"))
+	FName MedianValueAttributeName = FName(TEXT("Median"));
+
+	/** Arbitrary quantile of numeric attributes. Non-numeric attributes output their default value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputQuantileValue = false;
+
+	/** */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Quantile", EditCondition="bOutputQuantileValue"))
+	FName QuantileValueAttributeName = FName(TEXT("Quantile"));
+
+	/** */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = " └─ Quantile", EditCondition="bOutputQuantileValue", ClampMin=0, ClampMax=1))
+	double Quantile = 0.9;
+
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputUniqueValuesNum = true;
@@ -248,6 +283,70 @@ namespace PCGExAttributeStats
 	const FName OutputAttributeStats = FName("Stats");
 	const FName OutputAttributeUniqueValues = FName("UniqueValues");
 
+	/**
+	 * HyperLogLog cardinality sketch over 64bit hashes.
+	 * Sketches built with the same precision merge losslessly.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FHyperLogLog
+	{
+		TArray<uint8> Registers;
+		int32 Precision = 0;
+
+	public:
+		FHyperLogLog() = default;
+
+		void Init(const int32 InPrecision);
+		FORCEINLINE bool IsValid() const { return !Registers.IsEmpty(); }
+
+		void Add(const uint64 Hash);
+		void Merge(const FHyperLogLog& Other);
+		double Estimate() const;
+
+		static FORCEINLINE uint64 Mix(uint64 Hash)
+		{
+			// splitmix64 finalizer, spreads 32bit type hashes over the full range
+			Hash += 0x9E3779B97F4A7C15ull;
+			Hash = (Hash ^ (Hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+			Hash = (Hash ^ (Hash >> 27)) * 0x94D049BB133111EBull;
+			return Hash ^ (Hash >> 31);
+		}
+	};
+
+	/**
+	 * Merging t-digest for streaming quantile estimates.
+	 * Centroids are bounded by the arcsine scale function, so tails stay accurate.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FTDigest
+	{
+		struct FCentroid
+		{
+			double Mean = 0;
+			double Weight = 0;
+		};
+
+		TArray<FCentroid> Centroids;
+		TArray<FCentroid> Pending;
+		double Compression = 100;
+		double TotalWeight = 0;
+		double Min = MAX_dbl;
+		double Max = -MAX_dbl;
+
+	public:
+		explicit FTDigest(const double InCompression = 100)
+			: Compression(InCompression)
+		{
+		}
+
+		FORCEINLINE bool IsEmpty() const { return TotalWeight <= 0; }
+
+		void Add(const double Value, const double Weight = 1);
+		void Merge(const FTDigest& Other);
+		double Quantile(const double Q);
+
+	protected:
+		void Compress();
+	};
+
 	class IAttributeStats : public TSharedFromThis<IAttributeStats>
 	{
 	public:
@@ -261,11 +360,24 @@ namespace PCGExAttributeStats
 
 		virtual ~IAttributeStats() = default;
 
-		virtual void Process(
-			const TSharedRef<PCGExData::FFacade> InDataFacade,
-			FPCGExAttributeStatsContext* Context,
+		// Grab a scoped readable & allocate one partial per loop scope
+		virtual void Init(
+			const TSharedRef<PCGExData::FFacade>& InDataFacade,
 			const UPCGExAttributeStatsSettings* Settings,
-			const TArray<int8>& Filter)
+			const int32 NumScopes)
+		{
+		}
+
+		// Accumulate a scope into its own partial; safe to call concurrently on different scopes
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter)
+		{
+		}
+
+		// Merge partials & write outputs
+		virtual void Output(
+			const TSharedRef<PCGExData::FFacade>& InDataFacade,
+			FPCGExAttributeStatsContext* Context,
+			const UPCGExAttributeStatsSettings* Settings)
 		{
 		}
 	};
@@ -273,32 +385,156 @@ namespace PCGExAttributeStats
 	template <typename T>
 	class TAttributeStats : public IAttributeStats
 	{
-	public:
+		static constexpr bool bHashable = PCGEx::IsValidForTMap<T>::value;
+		static constexpr bool bNumeric = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+		// Unhashable types never track values; keep the map declarable
+		using FCountKey = std::conditional_t<bHashable, T, int32>;
+
+		struct FPartial
+		{
+			int32 NumValues = 0;
+			int32 DefaultValuesNum = 0;
+
+			T MinValue = T{};
+			T MaxValue = T{};
+			T SetMinValue = T{};
+			T SetMaxValue = T{};
+			T SumValue = T{};
+
+			TMap<FCountKey, int32> ValuesCount;
+			TMap<FCountKey, int32> SetValuesCount;
+
+			FHyperLogLog Values;
+			FHyperLogLog SetValues;
+			FTDigest Digest;
+
+			FPartial()
+			{
+				PCGExMath::TypeMinMax(MinValue, MaxValue);
+				PCGExMath::TypeMinMax(SetMinValue, SetMaxValue);
+			}
+
+			void Merge(FPartial& Other)
+			{
+				NumValues += Other.NumValues;
+				DefaultValuesNum += Other.DefaultValuesNum;
+
+				MinValue = PCGExBlend::Min(MinValue, Other.MinValue);
+				MaxValue = PCGExBlend::Max(MaxValue, Other.MaxValue);
+				SetMinValue = PCGExBlend::Min(SetMinValue, Other.SetMinValue);
+				SetMaxValue = PCGExBlend::Max(SetMaxValue, Other.SetMaxValue);
+				SumValue = PCGExBlend::Add(SumValue, Other.SumValue);
+
+				ValuesCount.Reserve(ValuesCount.Num() + Other.ValuesCount.Num());
+				for (const TPair<FCountKey, int32>& Pair : Other.ValuesCount) { ValuesCount.FindOrAdd(Pair.Key, 0) += Pair.Value; }
+
+				SetValuesCount.Reserve(SetValuesCount.Num() + Other.SetValuesCount.Num());
+				for (const TPair<FCountKey, int32>& Pair : Other.SetValuesCount) { SetValuesCount.FindOrAdd(Pair.Key, 0) += Pair.Value; }
+
+				if (Other.Values.IsValid()) { Values.Merge(Other.Values); }
+				if (Other.SetValues.IsValid()) { SetValues.Merge(Other.SetValues); }
+
+				Digest.Merge(Other.Digest);
+
+				Other = FPartial();
+			}
+		};
+
+		TSharedPtr<PCGExData::TBuffer<T>> Buffer;
+		TArray<FPartial> Partials;
+
 		T DefaultValue = T{};
-		T MinValue = T{};
-		T MaxValue = T{};
-		T SetMinValue = T{};
-		T SetMaxValue = T{};
-		T AverageValue = T{};
-		T AverageSetValue = T{};
-		T MaxUniqueValue = T{};
-		T MinUniqueValue = T{};
-		int32 UniqueValuesNum = 0;
-		int32 UniqueSetValuesNum = 0;
-		int32 DifferentValuesNum = 0;
-		int32 DifferentSetValuesNum = 0;
-		int32 DefaultValuesNum = 0;
+		bool bExact = true;
+		bool bWantsQuantiles = false;
 
+	public:
 		explicit TAttributeStats(const PCGEx::FAttributeIdentity& InIdentity, const int64 InKey)
 			: IAttributeStats(InIdentity, InKey)
 		{
 		}
 
-		virtual void Process(
-			const TSharedRef<PCGExData::FFacade> InDataFacade,
-			FPCGExAttributeStatsContext* Context,
+		virtual void Init(
+			const TSharedRef<PCGExData::FFacade>& InDataFacade,
 			const UPCGExAttributeStatsSettings* Settings,
-			const TArray<int8>& Filter) override
+			const int32 NumScopes) override
+		{
+			Buffer = InDataFacade->GetReadable<T>(Identity.Identifier, PCGExData::EIOSide::In, true);
+			if (!Buffer) { return; }
+
+			DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
+
+			bExact = Settings->UniqueValuesMode == EPCGExStatsUniqueMode::Exact || Settings->bOutputPerUniqueValuesStats;
+			bWantsQuantiles = bNumeric && (Settings->bOutputMedianValue || Settings->bOutputQuantileValue);
+
+			Partials.SetNum(NumScopes);
+
+			if constexpr (bHashable)
+			{
+				if (!bExact)
+				{
+					for (FPartial& Partial : Partials)
+					{
+						Partial.Values.Init(Settings->SketchPrecision);
+						Partial.SetValues.Init(Settings->SketchPrecision);
+					}
+				}
+			}
+		}
+
+		virtual void ProcessScope(const PCGExMT::FScope& Scope, const TArray<int8>& Filter) override
+		{
+			if (!Buffer) { return; }
+
+			FPartial& Partial = Partials[Scope.LoopIndex];
+
+			PCGEX_SCOPE_LOOP(i)
+			{
+				if (!Filter[i]) { continue; }
+				Partial.NumValues++;
+
+				const T& Value = Buffer->Read(i);
+
+				Partial.MinValue = PCGExBlend::Min(Partial.MinValue, Value);
+				Partial.MaxValue = PCGExBlend::Max(Partial.MaxValue, Value);
+				Partial.SumValue = PCGExBlend::Add(Partial.SumValue, Value);
+
+				const bool bIsDefault = PCGExCompare::StrictlyEqual(Value, DefaultValue);
+
+				if (bIsDefault) { Partial.DefaultValuesNum++; }
+				else
+				{
+					Partial.SetMinValue = PCGExBlend::Min(Partial.SetMinValue, Value);
+					Partial.SetMaxValue = PCGExBlend::Max(Partial.SetMaxValue, Value);
+				}
+
+				if constexpr (bHashable)
+				{
+					if (bExact)
+					{
+						Partial.ValuesCount.FindOrAdd(Value, 0)++;
+						if (!bIsDefault) { Partial.SetValuesCount.FindOrAdd(Value, 0)++; }
+					}
+					else
+					{
+						const uint64 Hash = FHyperLogLog::Mix(GetTypeHash(Value));
+						Partial.Values.Add(Hash);
+						if (!bIsDefault) { Partial.SetValues.Add(Hash); }
+					}
+				}
+
+				if constexpr (bNumeric)
+				{
+					// Exact mode derives quantiles from the value counts instead
+					if (bWantsQuantiles && !bExact) { Partial.Digest.Add(static_cast<double>(Value)); }
+				}
+			}
+		}
+
+		virtual void Output(
+			const TSharedRef<PCGExData::FFacade>& InDataFacade,
+			FPCGExAttributeStatsContext* Context,
+			const UPCGExAttributeStatsSettings* Settings) override
 		{
 			UPCGParamData* ParamData = Context->OutputParamsMap[Identity.Identifier.Name];
 
@@ -314,9 +550,6 @@ namespace PCGExAttributeStats
 		FPCGAttributeIdentifier PrintName(Settings->OutputToPoints == EPCGExStatsOutputToPoints::Prefix ? FName(Settings->_NAME##AttributeName.ToString() + StrName) : FName(StrName + Settings->_NAME##AttributeName.ToString()), PCGMetadataDomainID::Data);\
 		if (PointsMetadata->GetConstTypedAttribute<_TYPE>(PrintName)) { PointsMetadata->DeleteAttribute(PrintName); }\
 		PointsMetadata->FindOrCreateAttribute<_TYPE>(PrintName, _VALUE);} }
-			TSharedPtr<PCGExData::TBuffer<T>> Buffer = InDataFacade->GetReadable<T>(Identity.Identifier);
-			PCGExMath::TypeMinMax(MinValue, MaxValue);
-			PCGExMath::TypeMinMax(SetMinValue, SetMaxValue);
 
 			if (!Buffer)
 			{
@@ -328,13 +561,20 @@ namespace PCGExAttributeStats
 			const FString Identifier = FString::Printf(TEXT("PCGEx/Identifier:%u"), InDataFacade->Source->GetIn()->GetUniqueID());
 			PCGEX_OUTPUT_STAT(Identifier, FString, Identifier)
 
-			if constexpr (!PCGEx::IsValidForTMap<T>::value)
+			if constexpr (!bHashable)
 			{
 				// Unsupported types
 				PCGEX_OUTPUT_STAT(IsValid, bool, false)
 			}
 			else
 			{
+				// Merge partials in scope order
+				FPartial Stats;
+				for (FPartial& Partial : Partials) { Stats.Merge(Partial); }
+				Partials.Empty();
+
+				const int32 NumValues = Stats.NumValues;
+
 				UPCGParamData* UniqueValuesParamData = nullptr;
 				if (Settings->bOutputPerUniqueValuesStats)
 				{
@@ -346,119 +586,113 @@ namespace PCGExAttributeStats
 					StagedData.Tags.Add(Identity.Identifier.Name.ToString());
 
 					InDataFacade->Source->Tags->AddRaw(Identifier);
-				}
-
-				const int32 NumPoints = InDataFacade->GetNum();
-				TMap<T, int32> ValuesCount;
-				TMap<T, int32> SetValuesCount;
-				ValuesCount.Reserve(NumPoints);
-				SetValuesCount.Reserve(NumPoints);
-
-				DefaultValue = Buffer->GetTypedInAttribute()->GetValueFromItemKey(PCGDefaultValueKey);
-				int32 NumValues = 0;
-
-				/*
-				auto ProcessBasics = [&](const T& InValue)
-				{
-					MinValue = PCGExBlend::Min(MinValue, InValue);
-					MaxValue = PCGExBlend::Max(MaxValue, InValue);
-					AverageValue = PCGExBlend::Add(AverageValue, InValue);
-				};
-				*/
 
-				for (int i = 0; i < NumPoints; i++)
-				{
-					if (!Filter[i]) { continue; }
-					NumValues++;
+					UPCGMetadata* UVM = UniqueValuesParamData->Metadata;
+					FPCGMetadataAttribute<T>* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, Stats.MinValue);
+					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
 
-					const T& Value = Buffer->Read(i);
+					for (const TPair<T, int32>& Pair : Settings->bOmitDefaultValue ? Stats.SetValuesCount : Stats.ValuesCount)
+					{
+						int64 UVKey = UVM->AddEntry();
+						UValues->SetValue(UVKey, Pair.Key);
+						UCount->SetValue(UVKey, Pair.Value);
+					}
+				}
 
-					MinValue = PCGExBlend::Min(MinValue, Value);
-					MaxValue = PCGExBlend::Max(MaxValue, Value);
-					AverageValue = PCGExBlend::Add(AverageValue, Value);
+				int32 UniqueValuesNum = -1;
+				int32 UniqueSetValuesNum = -1;
+				int32 DifferentValuesNum = 0;
+				int32 DifferentSetValuesNum = 0;
 
-					const int32 Count = ValuesCount.FindOrAdd(Value, 0);
-					ValuesCount.Add(Value, Count + 1);
+				T MedianValue = DefaultValue;
+				T QuantileValue = DefaultValue;
 
-					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+				if (bExact)
+				{
+					if (Settings->bOutputUniqueValuesNum)
 					{
-						DefaultValuesNum++;
+						UniqueValuesNum = 0;
+						for (const TPair<T, int32>& Pair : Stats.ValuesCount) { if (Pair.Value == 1) { UniqueValuesNum++; } }
 					}
-					else
-					{
-						const int32 SetCount = SetValuesCount.FindOrAdd(Value, 0);
-						SetValuesCount.Add(Value, SetCount + 1);
 
-						SetMinValue = PCGExBlend::Min(SetMinValue, Value);
-						SetMaxValue = PCGExBlend::Max(SetMaxValue, Value);
+					if (Settings->bOutputUniqueSetValuesNum || Settings->bOutputHasOnlyUniqueValues)
+					{
+						UniqueSetValuesNum = 0;
+						for (const TPair<T, int32>& Pair : Stats.SetValuesCount) { if (Pair.Value == 1) { UniqueSetValuesNum++; } }
 					}
-				}
 
-				if (UniqueValuesParamData)
-				{
-					UPCGMetadata* UVM = UniqueValuesParamData->Metadata;
-					FPCGMetadataAttribute<T>* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, MinValue);
-					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
+					DifferentValuesNum = Stats.ValuesCount.Num();
+					DifferentSetValuesNum = Stats.SetValuesCount.Num();
 
-					if (Settings->bOmitDefaultValue)
+					if constexpr (bNumeric)
 					{
-						for (const TPair<T, int32>& Pair : SetValuesCount)
+						if (bWantsQuantiles && NumValues > 0)
 						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
+							Stats.ValuesCount.KeySort([](const T& A, const T& B) { return A < B; });
+
+							auto ExactQuantile = [&](const double Q)
+							{
+								const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Q * NumValues), 1, NumValues);
+								int32 Cumulative = 0;
+								for (const TPair<T, int32>& Pair : Stats.ValuesCount)
+								{
+									Cumulative += Pair.Value;
+									if (Cumulative >= Rank) { return Pair.Key; }
+								}
+								return Stats.MaxValue;
+							};
+
+							MedianValue = ExactQuantile(0.5);
+							QuantileValue = ExactQuantile(Settings->Quantile);
 						}
 					}
-					else
+				}
+				else
+				{
+					DifferentValuesNum = Stats.Values.IsValid() ? FMath::RoundToInt32(Stats.Values.Estimate()) : 0;
+					DifferentSetValuesNum = Stats.SetValues.IsValid() ? FMath::RoundToInt32(Stats.SetValues.Estimate()) : 0;
+
+					if constexpr (bNumeric)
 					{
-						for (const TPair<T, int32>& Pair : ValuesCount)
+						if (bWantsQuantiles && !Stats.Digest.IsEmpty())
 						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
+							MedianValue = static_cast<T>(Stats.Digest.Quantile(0.5));
+							QuantileValue = static_cast<T>(Stats.Digest.Quantile(Settings->Quantile));
 						}
 					}
 				}
 
-				if (Settings->bOutputUniqueValuesNum)
-				{
-					UniqueValuesNum = 0;
-					for (const TPair<T, int32>& Pair : ValuesCount) { if (Pair.Value == 1) { UniqueValuesNum++; } }
-				}
-
-				if (Settings->bOutputUniqueSetValuesNum)
-				{
-					UniqueSetValuesNum = 0;
-					for (const TPair<T, int32>& Pair : SetValuesCount) { if (Pair.Value == 1) { UniqueSetValuesNum++; } }
-				}
+				Stats.ValuesCount.Empty();
+				Stats.SetValuesCount.Empty();
 
-				DifferentValuesNum = ValuesCount.Num();
-				DifferentSetValuesNum = SetValuesCount.Num();
-
-				ValuesCount.Empty();
-				SetValuesCount.Empty();
+				// Sketches can't tell singletons apart; fall back to "every set value is different"
+				const bool bHasOnlyUniqueValues = bExact ? NumValues == UniqueSetValuesNum : (Stats.DefaultValuesNum == 0 && DifferentSetValuesNum >= NumValues);
 
 				////// OUTPUT
 
 				PCGEX_OUTPUT_STAT(DefaultValue, T, DefaultValue)
-				PCGEX_OUTPUT_STAT(MinValue, T, MinValue)
-				PCGEX_OUTPUT_STAT(MaxValue, T, MaxValue)
-				PCGEX_OUTPUT_STAT(SetMinValue, T, SetMinValue)
-				PCGEX_OUTPUT_STAT(SetMaxValue, T, SetMaxValue)
-				PCGEX_OUTPUT_STAT(AverageValue, T, PCGExBlend::Div(AverageValue, static_cast<double>(NumValues)))
+				PCGEX_OUTPUT_STAT(MinValue, T, Stats.MinValue)
+				PCGEX_OUTPUT_STAT(MaxValue, T, Stats.MaxValue)
+				PCGEX_OUTPUT_STAT(SetMinValue, T, Stats.SetMinValue)
+				PCGEX_OUTPUT_STAT(SetMaxValue, T, Stats.SetMaxValue)
+				PCGEX_OUTPUT_STAT(AverageValue, T, PCGExBlend::Div(Stats.SumValue, static_cast<double>(NumValues)))
+				PCGEX_OUTPUT_STAT(MedianValue, T, MedianValue)
+				PCGEX_OUTPUT_STAT(QuantileValue, T, QuantileValue)
 				PCGEX_OUTPUT_STAT(UniqueValuesNum, int32, UniqueValuesNum)
 				PCGEX_OUTPUT_STAT(UniqueSetValuesNum, int32, UniqueSetValuesNum)
 				PCGEX_OUTPUT_STAT(DifferentValuesNum, int32, DifferentValuesNum)
 				PCGEX_OUTPUT_STAT(DifferentSetValuesNum, int32, DifferentSetValuesNum)
-				PCGEX_OUTPUT_STAT(DefaultValuesNum, int32, DefaultValuesNum)
-				PCGEX_OUTPUT_STAT(HasOnlyDefaultValues, bool, NumValues == DefaultValuesNum)
-				PCGEX_OUTPUT_STAT(HasOnlySetValues, bool, DefaultValuesNum == 0)
-				PCGEX_OUTPUT_STAT(HasOnlyUniqueValues, bool, NumValues == UniqueSetValuesNum)
+				PCGEX_OUTPUT_STAT(DefaultValuesNum, int32, Stats.DefaultValuesNum)
+				PCGEX_OUTPUT_STAT(HasOnlyDefaultValues, bool, NumValues == Stats.DefaultValuesNum)
+				PCGEX_OUTPUT_STAT(HasOnlySetValues, bool, Stats.DefaultValuesNum == 0)
+				PCGEX_OUTPUT_STAT(HasOnlyUniqueValues, bool, bHasOnlyUniqueValues)
 				PCGEX_OUTPUT_STAT(Samples, int32, NumValues)
 				PCGEX_OUTPUT_STAT(IsValid, bool, true)
 
 #undef PCGEX_OUTPUT_STAT
 			}
+
+			Buffer.Reset();
 		}
 	};
 
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 
 #include "PCGExPointsProcessor.h"
+#include "PCGExScopedContainers.h"
 
 
 #include "PCGExDiscardByOverlap.generated.h"
@@ -165,14 +166,8 @@ struct FPCGExDiscardByOverlapContext final : FPCGExPointsProcessorContext
 {
 	friend class FPCGExDiscardByOverlapElement;
 
-	mutable FRWLock OverlapLock;
 	TMap<uint64, TSharedPtr<PCGExDiscardByOverlap::FOverlap>> OverlapMap;
 
-	TSharedPtr<PCGExDiscardByOverlap::FOverlap> RegisterOverlap(
-		PCGExDiscardByOverlap::FProcessor* InA,
-		PCGExDiscardByOverlap::FProcessor* InB,
-		const FBox& InIntersection);
-
 	FPCGExOverlapScoresWeighting Weights;
 	FPCGExOverlapScoresWeighting MaxScores;
 	void UpdateMaxScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack);
@@ -287,9 +282,54 @@ namespace PCGExDiscardByOverlap
 
 	PCGEX_OCTREE_SEMANTICS(FPointBounds, { return Element->Bounds; }, { return A->Point == B->Point; })
 
+	struct PCGEXTENDEDTOOLKIT_API FBoundsPair
+	{
+		int32 A = -1;
+		int32 B = -1;
+		FBox Intersection = FBox(NoInit);
+
+		FBoundsPair(const int32 InA, const int32 InB, const FBox& InIntersection)
+			: A(InA), B(InB), Intersection(InIntersection)
+		{
+		}
+	};
+
+	/**
+	 * Sweep-and-prune broad phase over a set of bounds, running on task groups :
+	 * valid bounds are sorted along X, then swept in sub-loops, each scope writing to its own pair buffer.
+	 * Pairs are output with A < B, in sweep order; invalid bounds are ignored.
+	 */
+	class PCGEXTENDEDTOOLKIT_API FSweepAndPrune : public TSharedFromThis<FSweepAndPrune>
+	{
+		TWeakPtr<PCGExMT::FTaskManager> AsyncManager;
+		TArray<FBox> Bounds;
+		TArray<int32> Order;
+		TArray<TArray<FBoundsPair>> ScopedPairs;
+
+	public:
+		PCGExMT::FSimpleCallback OnCompleteCallback;
+
+		explicit FSweepAndPrune(TArray<FBox>&& InBounds);
+
+		void Start(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager);
+		void GetPairs(TArray<FBoundsPair>& OutPairs) const;
+
+	protected:
+		void StartSweep();
+		void SweepScope(const PCGExMT::FScope& Scope);
+
+		FORCEINLINE bool SweepLess(const int32 A, const int32 B) const
+		{
+			const double MinA = Bounds[A].Min.X;
+			const double MinB = Bounds[B].Min.X;
+			return MinA == MinB ? A < B : MinA < MinB;
+		}
+	};
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExDiscardByOverlapContext, UPCGExDiscardByOverlapSettings>
 	{
 		friend struct FPCGExDiscardByOverlapContext;
+		friend class FBatch;
 
 		const UPCGBasePointData* InPoints = nullptr;
 		FBox Bounds = FBox(ForceInit);
@@ -298,7 +338,9 @@ namespace PCGExDiscardByOverlap
 
 		TArray<TSharedPtr<FPointBounds>> LocalPointBounds;
 
-		mutable FRWLock RegistrationLock;
+		TSharedPtr<PCGExMT::TScopedValue<FBox>> ScopedBounds;
+		TSharedPtr<PCGExMT::TScopedNumericValue<double>> ScopedVolume;
+
 		TArray<TSharedPtr<FOverlap>> Overlaps;
 		TArray<TSharedPtr<FOverlap>> ManagedOverlaps;
 
@@ -329,18 +371,17 @@ namespace PCGExDiscardByOverlap
 
 		FORCEINLINE bool HasOverlaps() const { return !Overlaps.IsEmpty(); }
 
-		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
 		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& Stack);
 		void Prune(TArray<FProcessor*>& Stack);
 
-		void RegisterPointBounds(const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds)
+		void RegisterPointBounds(const PCGExMT::FScope& Scope, const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds)
 		{
 			const int8 bValidPoint = PointFilterCache[Index];
 			if (!bValidPoint && !Settings->bIncludeFilteredInMetrics) { return; }
 
 			const FBox& B = InPointBounds->Bounds.GetBox();
-			Bounds += B;
-			TotalVolume += B.GetVolume();
+			ScopedBounds->GetMutable(Scope) += B;
+			ScopedVolume->GetMutable(Scope) += B.GetVolume();
 
 			if (bValidPoint) { LocalPointBounds[Index] = InPointBounds; }
 		}
@@ -354,4 +395,18 @@ namespace PCGExDiscardByOverlap
 		void UpdateWeightValues();
 		void UpdateWeight(const FPCGExOverlapScoresWeighting& InMax);
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+		TArray<FProcessor*> Candidates;
+		TSharedPtr<FSweepAndPrune> SweepAndPrune;
+
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
+
+	protected:
+		virtual void OnInitialPostProcess() override;
+
+		void RegisterOverlaps();
+	};
 }
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExPartition.h"
 #include "PCGExPointsProcessor.h"
+#include "PCGExScopedContainers.h"
 
 
 #include "PCGExPartitionByValues.generated.h"
@@ -18,7 +19,6 @@ namespace PCGExPartition
 	{
 	protected:
 		mutable FRWLock LayersLock;
-		mutable FRWLock PointLock;
 
 	public:
 		FKPartition(const TWeakPtr<FKPartition>& InParent, int64 InKey, FRule* InRule, int32 InPartitionIndex);
@@ -39,8 +39,6 @@ namespace PCGExPartition
 
 		TSharedPtr<FKPartition> GetPartition(int64 Key, FRule* InRule);
 
-		void Add(const int64 Index);
-
 		void Register(TArray<TSharedPtr<FKPartition>>& Partitions);
 
 		void SortPartitions();
@@ -144,6 +142,18 @@ namespace PCGExPartitionByValues
 		int32 NumPartitions = -1;
 		TArray<TSharedPtr<PCGExPartition::FKPartition>> Partitions;
 
+		// Counting-sort partitioning
+		// Each point gets a composite key (mixed-radix over per-rule value ranks), counted per scope,
+		// then scattered into preallocated, contiguous leaf ranges.
+		TArray<TSharedPtr<PCGExMT::TScopedSet<int64>>> ScopedRuleValues;
+		TArray<TArray<int64>> RuleUniqueValues;
+		TArray<int64> RuleStrides;
+
+		TArray<int64> PointKeys;
+		TArray<TMap<int64, int32>> ScopedKeyCounts;
+		TMap<int64, int32> KeyToLeaf;
+		TArray<TSharedPtr<PCGExPartition::FKPartition>> Leaves;
+
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
 			TProcessor(InPointDataFacade)
@@ -151,7 +161,15 @@ namespace PCGExPartitionByValues
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
+		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
+
+		void ComputeKeys(const PCGExMT::FScope& Scope);
+		void PrepareLeaves();
+		void ScatterPoints(const PCGExMT::FScope& Scope);
+		void BuildPartitionsSynchronous();
+
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void CompleteWork() override;
 	};
@@ -128,9 +128,6 @@ namespace PCGExUberFilter
 		int32 NumInside = 0;
 		int32 NumOutside = 0;
 
-		TSharedPtr<PCGExMT::TScopedArray<int32>> IndicesInside;
-		TSharedPtr<PCGExMT::TScopedArray<int32>> IndicesOutside;
-
 		TSharedPtr<PCGExData::TBuffer<bool>> Results;
 
 		bool bUsePicks = false;
@@ -148,7 +145,6 @@ namespace PCGExUberFilter
 		virtual ~FProcessor() override;
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
-		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 
 		TSharedPtr<PCGExData::FPointIO> CreateIO(const TSharedRef<PCGExData::FPointIOCollection>& InCollection, const PCGExData::EIOInit InitMode) const;
@@ -394,9 +394,39 @@ namespace PCGExCompare
 		}
 	}
 
+	// Scope variant of Compare : ANDs the result of A[i] vs B[i] into InOutMask[i].
+	// The method is resolved once per scope so the inner loops are branch-free.
+	template <typename T>
+	static void CompareScope(const EPCGExComparison Method, const TConstArrayView<T> A, const TConstArrayView<T> B, const TArrayView<int8> InOutMask, const double Tolerance = DBL_COMPARE_TOLERANCE)
+	{
+		check(A.Num() == B.Num() && A.Num() == InOutMask.Num())
+
+		const int32 Num = A.Num();
+
+#define PCGEX_COMPARE_SCOPE(_METHOD, _TEST) case EPCGExComparison::_METHOD: for (int i = 0; i < Num; i++) { InOutMask[i] &= static_cast<int8>(_TEST); } break;
+
+		switch (Method)
+		{
+		PCGEX_COMPARE_SCOPE(StrictlyEqual, StrictlyEqual(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(StrictlyNotEqual, StrictlyNotEqual(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(EqualOrGreater, EqualOrGreater(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(EqualOrSmaller, EqualOrSmaller(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(StrictlyGreater, StrictlyGreater(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(StrictlySmaller, StrictlySmaller(A[i], B[i]))
+		PCGEX_COMPARE_SCOPE(NearlyEqual, NearlyEqual(A[i], B[i], Tolerance))
+		PCGEX_COMPARE_SCOPE(NearlyNotEqual, NearlyNotEqual(A[i], B[i], Tolerance))
+		default:
+			FMemory::Memzero(InOutMask.GetData(), Num * sizeof(int8));
+			break;
+		}
+
+#undef PCGEX_COMPARE_SCOPE
+	}
+
 	bool Compare(const EPCGExComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const double B, const double Tolerance = DBL_COMPARE_TOLERANCE);
 	bool Compare(const EPCGExStringComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const FString B);
 	bool Compare(const EPCGExBitflagComparison Method, const int64& Flags, const int64& Mask);
+	void CompareScope(const EPCGExBitflagComparison Method, const TConstArrayView<int64> Flags, const TConstArrayView<int64> Masks, const TArrayView<int8> InOutMask, const bool bInvert = false);
 
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict = true);
 	bool GetMatchingValueTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, TArray<TSharedPtr<PCGExData::IDataValue>>& OutValues);
@@ -555,6 +585,7 @@ struct PCGEXTENDEDTOOLKIT_API FPCGExDotComparisonDetails
 
 	bool Test(const double A, const double B) const;
 	bool Test(const double A, const int32 Index) const;
+	void TestScope(const int32 Start, const TConstArrayView<double> Dots, const TArrayView<int8> InOutMask) const;
 
 	void RegisterConsumableAttributesWithData(FPCGExContext* InContext, const UPCGData* InData) const;
 	bool GetOnlyUseDataDomain() const;
@@ -58,6 +58,7 @@ namespace PCGExDetails
 
 		FORCEINLINE virtual bool IsConstant() { return false; }
 		FORCEINLINE virtual T Read(const int32 Index) = 0;
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) = 0;
 		FORCEINLINE virtual T Min() = 0;
 		FORCEINLINE virtual T Max() = 0;
 	};
@@ -91,6 +92,7 @@ namespace PCGExDetails
 		}
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Buffer->Read(Index); }
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) override { Buffer->ReadScope(Start, OutValues); }
 		FORCEINLINE virtual T Min() override { return Buffer->Min; }
 		FORCEINLINE virtual T Max() override { return Buffer->Max; }
 	};
@@ -123,6 +125,7 @@ namespace PCGExDetails
 		}
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Buffer->Read(Index); }
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) override { Buffer->ReadScope(Start, OutValues); }
 		FORCEINLINE virtual T Min() override { return Buffer->Min; }
 		FORCEINLINE virtual T Max() override { return Buffer->Max; }
 	};
@@ -145,6 +148,7 @@ namespace PCGExDetails
 		FORCEINLINE virtual void SetConstant(T InConstant) override { Constant = InConstant; };
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Constant; }
+		virtual void ReadScope(const int32 Start, TArrayView<T> OutValues) override { for (T& Value : OutValues) { Value = Constant; } }
 		FORCEINLINE virtual T Min() override { return Constant; }
 		FORCEINLINE virtual T Max() override { return Constant; }
 	};
@@ -94,6 +94,23 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Persist built cluster topology to disk (Saved/PCGEx/ClusterCache), keyed by a hash of the vtx/edge endpoint data, so later executions can skip rebuilding it. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bPersistentClusterCache = false;
+
+	/** Clusters with fewer edges than this are always rebuilt, as file IO would cost more than the build itself. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheMinEdges = 4096;
+	bool WantsPersistentClusterCache(const int32 InNumEdges) const { return bPersistentClusterCache && InNumEdges >= PersistentClusterCacheMinEdges; }
+
+	/** Maximum size of the persistent cluster cache on disk, in megabytes. Least recently used entries are deleted whenever a new cluster is written past that limit. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheMaxSizeMB = 512;
+
+	/** Delete every cluster persisted to disk (Saved/PCGEx/ClusterCache). */
+	UFUNCTION(CallInEditor, Category = "Performance|Cluster", meta=(DisplayName="Clear Persistent Cluster Cache"))
+	void ClearPersistentClusterCache();
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -504,4 +504,123 @@ namespace PCGExMT
 	TSharedPtr<FDeferredCallbackHandle> DeferredCallback(FPCGExContext* InContext, FSimpleCallback&& InCallback);
 	PCGEXTENDEDTOOLKIT_API
 	void CancelDeferredCallback(const TSharedPtr<FDeferredCallbackHandle>& InCallback);
+
+	/**
+	 * Parallel merge sort running on task groups : chunks are sorted as sub-loops, then merged pairwise, one group per pass.
+	 * The array must outlive the sort. Not stable; use a predicate that defines a total order when the output order matters.
+	 */
+	template <typename T, typename PredicateT>
+	class TParallelSort final : public TSharedFromThis<TParallelSort<T, PredicateT>>
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "ParallelSort only supports trivially copyable types.");
+
+		TWeakPtr<FTaskManager> AsyncManager;
+		TArray<T>& Array;
+		PredicateT Predicate;
+
+		TArray<T> Buffer;
+		T* Src = nullptr;
+		T* Dst = nullptr;
+		int32 Width = 0;
+
+	public:
+		FSimpleCallback OnCompleteCallback;
+
+		TParallelSort(const TSharedPtr<FTaskManager>& InAsyncManager, TArray<T>& InArray, const PredicateT& InPredicate)
+			: AsyncManager(InAsyncManager), Array(InArray), Predicate(InPredicate)
+		{
+		}
+
+		void Start(const int32 ChunkSize = 4096)
+		{
+			const int32 Num = Array.Num();
+			if (Num <= ChunkSize)
+			{
+				Array.Sort(Predicate);
+				if (OnCompleteCallback) { OnCompleteCallback(); }
+				return;
+			}
+
+			const TSharedPtr<FTaskManager> Manager = AsyncManager.Pin();
+			PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, SortChunksTask)
+
+			Width = ChunkSize;
+
+			SortChunksTask->OnCompleteCallback =
+				[This = this->AsShared()]()
+				{
+					This->Buffer.SetNumUninitialized(This->Array.Num());
+					This->Src = This->Array.GetData();
+					This->Dst = This->Buffer.GetData();
+					This->MergePass();
+				};
+
+			SortChunksTask->OnSubLoopStartCallback =
+				[This = this->AsShared()](const FScope& Scope)
+				{
+					Scope.GetView(This->Array).Sort(This->Predicate);
+				};
+
+			SortChunksTask->StartSubLoops(Num, ChunkSize);
+		}
+
+	protected:
+		void MergePass()
+		{
+			const int32 Num = Array.Num();
+
+			if (Width >= Num)
+			{
+				// Sorted data ended up in the buffer, hand it over
+				if (Src != Array.GetData()) { Swap(Array, Buffer); }
+				Buffer.Empty();
+
+				if (OnCompleteCallback) { OnCompleteCallback(); }
+				return;
+			}
+
+			const TSharedPtr<FTaskManager> Manager = AsyncManager.Pin();
+			PCGEX_ASYNC_GROUP_CHKD_VOID(Manager, MergePassTask)
+
+			MergePassTask->OnCompleteCallback =
+				[This = this->AsShared()]()
+				{
+					Swap(This->Src, This->Dst);
+					This->Width *= 2;
+					This->MergePass();
+				};
+
+			MergePassTask->OnIterationCallback =
+				[This = this->AsShared()](const int32 Pair, const FScope& Scope)
+				{
+					This->MergePair(Pair);
+				};
+
+			MergePassTask->StartIterations(FMath::DivideAndRoundUp(Num, Width * 2), 1);
+		}
+
+		void MergePair(const int32 Pair) const
+		{
+			const int32 Num = Array.Num();
+			const int32 Start = Pair * Width * 2;
+			const int32 Mid = FMath::Min(Start + Width, Num);
+			const int32 End = FMath::Min(Mid + Width, Num);
+
+			int32 A = Start;
+			int32 B = Mid;
+			int32 Out = Start;
+
+			while (A < Mid && B < End) { Dst[Out++] = Predicate(Src[B], Src[A]) ? Src[B++] : Src[A++]; }
+			while (A < Mid) { Dst[Out++] = Src[A++]; }
+			while (B < End) { Dst[Out++] = Src[B++]; }
+		}
+	};
+
+	template <typename T, typename PredicateT>
+	void ParallelSort(const TSharedPtr<FTaskManager>& AsyncManager, TArray<T>& InArray, const PredicateT& Predicate, FSimpleCallback&& OnComplete, const int32 ChunkSize = 4096)
+	{
+		const TSharedPtr<TParallelSort<T, PredicateT>> Sorter = MakeShared<TParallelSort<T, PredicateT>>(AsyncManager, InArray, Predicate);
+		Sorter->OnCompleteCallback = MoveTemp(OnComplete);
+		Sorter->Start(ChunkSize);
+	}
 }
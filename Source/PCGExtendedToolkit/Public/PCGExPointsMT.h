@@ -7,6 +7,7 @@
 #include "PCGExInstancedFactory.h"
 
 #include "PCGExMT.h"
+#include "PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointFilter.h"
 
@@ -95,6 +96,9 @@ namespace PCGExPointsMT
 		bool bDaisyChainProcessPoints = false;
 		bool bDaisyChainProcessRange = false;
 
+		// Must be set before Process to store filter results in PointFilterBits instead of PointFilterCache
+		bool bUsePointFilterBits = false;
+
 		int32 LocalPointProcessingChunkSize = -1;
 
 	public:
@@ -110,6 +114,7 @@ namespace PCGExPointsMT
 		TArray<TObjectPtr<const UPCGExFilterFactoryData>>* FilterFactories = nullptr;
 		bool DefaultPointFilterValue = true;
 		TArray<int8> PointFilterCache;
+		TSharedPtr<PCGExMT::FAtomicBitArray> PointFilterBits;
 
 		UPCGExInstancedFactory* PrimaryInstancedFactory = nullptr;
 
@@ -164,6 +169,9 @@ namespace PCGExPointsMT
 		virtual bool InitPrimaryFilters(const TArray<TObjectPtr<const UPCGExFilterFactoryData>>* InFilterFactories);
 		virtual int32 FilterScope(const PCGExMT::FScope& Scope);
 		virtual int32 FilterAll();
+
+		// Indices of the points in scope whose filter result matches bPass, appended in increasing order
+		int32 GatherFilteredIndices(const PCGExMT::FScope& Scope, TArray<int32>& OutIndices, const bool bPass = true) const;
 	};
 
 	template <typename TContext, typename TSettings>
@@ -162,4 +162,136 @@ namespace PCGExMT
 			return Result;
 		}
 	};
+
+	class FAtomicBitArray final : public TSharedFromThis<FAtomicBitArray>
+	{
+		// Fixed-size bit array that supports concurrent test-and-set, one bit per item.
+		TArray<int64> Words;
+		int32 NumBits = 0;
+
+	public:
+		explicit FAtomicBitArray(const int32 InNum, const bool bInValue = false)
+		{
+			Init(InNum, bInValue);
+		}
+
+		~FAtomicBitArray() = default;
+
+		void Init(const int32 InNum, const bool bInValue = false)
+		{
+			NumBits = InNum;
+			Words.Init(bInValue ? ~static_cast<int64>(0) : 0, (InNum + 63) >> 6);
+		}
+
+		FORCEINLINE int32 Num() const { return NumBits; }
+
+		FORCEINLINE bool Get(const int32 Index) const
+		{
+			return ((FPlatformAtomics::AtomicRead(Words.GetData() + (Index >> 6)) >> (Index & 63)) & 1) != 0;
+		}
+
+		// Set the bit and return its previous value
+		FORCEINLINE bool TestAndSet(const int32 Index)
+		{
+			const int64 Mask = static_cast<int64>(1) << (Index & 63);
+			return (FPlatformAtomics::InterlockedOr(Words.GetData() + (Index >> 6), Mask) & Mask) != 0;
+		}
+
+		FORCEINLINE void Clear(const int32 Index)
+		{
+			FPlatformAtomics::InterlockedAnd(Words.GetData() + (Index >> 6), ~(static_cast<int64>(1) << (Index & 63)));
+		}
+
+		int32 CountSetBits() const
+		{
+			int32 Count = 0;
+			for (int i = 0; i < Words.Num(); i++) { Count += FMath::CountBits(static_cast<uint64>(Words[i])); }
+			// Ignore padding bits past NumBits
+			if (const int32 Tail = NumBits & 63; Tail && !Words.IsEmpty()) { Count -= FMath::CountBits(static_cast<uint64>(Words.Last()) >> Tail); }
+			return Count;
+		}
+
+		// Write a contiguous range of bits from per-item values.
+		// Words fully covered by the range are stored as a whole, shared boundary words are merged atomically.
+		void Set(const int32 Start, const int32 Count, const int8* InValues)
+		{
+			const int32 End = Start + Count;
+			int32 Index = Start;
+
+			while (Index < End)
+			{
+				const int32 WordIndex = Index >> 6;
+				const int32 WordStart = WordIndex << 6;
+				const int32 First = Index - WordStart;
+				const int32 Last = FMath::Min(End - WordStart, 64);
+
+				uint64 Bits = 0;
+				for (int b = First; b < Last; b++) { if (InValues[WordStart + b - Start]) { Bits |= static_cast<uint64>(1) << b; } }
+
+				int64* Word = Words.GetData() + WordIndex;
+				const uint64 Mask = GetRangeMask(First, Last);
+
+				if (Mask == ~static_cast<uint64>(0))
+				{
+					FPlatformAtomics::AtomicStore(Word, static_cast<int64>(Bits));
+				}
+				else
+				{
+					FPlatformAtomics::InterlockedAnd(Word, static_cast<int64>(~Mask));
+					FPlatformAtomics::InterlockedOr(Word, static_cast<int64>(Bits));
+				}
+
+				Index = WordStart + Last;
+			}
+		}
+
+		// Number of bits in [Start, End[ matching bValue
+		int32 CountRange(const int32 Start, const int32 End, const bool bValue = true) const
+		{
+			int32 Count = 0;
+			ForEachWord(Start, End, bValue, [&](const int32 WordStart, const uint64 Bits) { Count += FMath::CountBits(Bits); });
+			return Count;
+		}
+
+		// Visit the index of each bit in [Start, End[ matching bValue, in increasing order.
+		// Cost is one read per word plus one call per match.
+		template <typename FuncT>
+		void ForEach(const int32 Start, const int32 End, const bool bValue, FuncT&& Func) const
+		{
+			ForEachWord(
+				Start, End, bValue, [&](const int32 WordStart, uint64 Bits)
+				{
+					while (Bits)
+					{
+						Func(WordStart + static_cast<int32>(FMath::CountTrailingZeros64(Bits)));
+						Bits &= Bits - 1;
+					}
+				});
+		}
+
+	protected:
+		// Bits [First, Last[ of a word
+		static FORCEINLINE uint64 GetRangeMask(const int32 First, const int32 Last)
+		{
+			const uint64 High = Last >= 64 ? ~static_cast<uint64>(0) : (static_cast<uint64>(1) << Last) - 1;
+			return High & ~((static_cast<uint64>(1) << First) - 1);
+		}
+
+		template <typename FuncT>
+		void ForEachWord(const int32 Start, const int32 End, const bool bValue, FuncT&& Func) const
+		{
+			if (End <= Start) { return; }
+
+			const int32 LastWord = (End - 1) >> 6;
+			for (int32 WordIndex = Start >> 6; WordIndex <= LastWord; WordIndex++)
+			{
+				const int32 WordStart = WordIndex << 6;
+				uint64 Bits = static_cast<uint64>(FPlatformAtomics::AtomicRead(Words.GetData() + WordIndex));
+				if (!bValue) { Bits = ~Bits; }
+
+				Bits &= GetRangeMask(FMath::Max(Start - WordStart, 0), FMath::Min(End - WordStart, 64));
+				if (Bits) { Func(WordStart, Bits); }
+			}
+		}
+	};
 }
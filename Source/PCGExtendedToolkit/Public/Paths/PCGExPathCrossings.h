@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExPathProcessor.h"
 #include "PCGExPaths.h"
+#include "Geometry/PCGExGeoBVH.h"
 
 #include "PCGExPointsProcessor.h"
 #include "Data/Blending/PCGExUnionBlender.h"
@@ -139,6 +140,11 @@ struct FPCGExPathCrossingsContext final : FPCGExPathProcessorContext
 
 	TSharedPtr<PCGExDetails::FDistances> Distances;
 	FPCGExBlendingDetails CrossingBlending;
+
+	// Shared broad phase over every cutting edge of every path
+	TArray<TSharedPtr<PCGExPaths::FPath>> CutterPaths;
+	TArray<uint64> CutterEdges; // H64(CutterPaths index, edge index), in BVH segment order
+	TSharedPtr<PCGExGeo::FSegmentBVH> CutterBVH;
 };
 
 class FPCGExPathCrossingsElement final : public FPCGExPathProcessorElement
@@ -170,6 +176,8 @@ namespace PCGExPathCrossings
 		TBitArray<> CanCut;
 		TBitArray<> CanBeCut;
 
+		TArray<int32> CutterEdges;
+
 		TSet<FName> ProtectedAttributes;
 		TSharedPtr<FPCGExSubPointsBlendOperation> SubBlending;
 
@@ -194,6 +202,9 @@ namespace PCGExPathCrossings
 		virtual bool IsTrivial() const override { return false; } // Force non-trivial because this shit is expensive
 
 		const PCGExPaths::FPathEdgeOctree* GetEdgeOctree() const { return Path->GetEdgeOctree(); }
+		const TSharedPtr<PCGExPaths::FPath>& GetPath() const { return Path; }
+		const TArray<int32>& GetCutterEdges() const { return CutterEdges; }
+		bool GetCanCut() const { return bCanCut; }
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
 		virtual void CompleteWork() override;
@@ -205,4 +216,18 @@ namespace PCGExPathCrossings
 
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+		int32 NumCutterSubtrees = 0;
+
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
+
+	protected:
+		virtual void OnInitialPostProcess() override;
+
+		void GatherCutters();
+		void BuildCutterSubtrees();
+	};
 }
@@ -11,6 +11,7 @@
 #include "Data/PCGExDataPreloader.h"
 #include "Data/PCGSplineStruct.h"
 #include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoBVH.h"
 #include "Graph/PCGExEdge.h"
 
 #include "PCGExPaths.generated.h"
@@ -762,7 +763,7 @@ namespace PCGExPaths
 		using TPath<ClosedLoop>::bClosedLoop;
 		using TPath<ClosedLoop>::Positions;
 
-		TSharedPtr<FPCGSplineStruct> Spline;
+		TSharedPtr<PCGExGeo::FSegmentBVH> EdgeBVH;
 		TArray<FVector2D> ProjectedPoints;
 		FQuat Projection;
 		FBox PolyBox = FBox(ForceInit);
@@ -788,8 +789,14 @@ namespace PCGExPaths
 			PolyBox += (PolyBoxCenter + FVector(0, 0, ExpandZ));
 			PolyBox += (PolyBoxCenter + FVector(0, 0, -ExpandZ));
 
-			if constexpr (ClosedLoop) { Spline = MakeSplineFromPoints(InTransforms, EPCGExSplinePointTypeRedux::Linear, true, false); }
-			else { Spline = MakeSplineFromPoints(InTransforms, EPCGExSplinePointTypeRedux::Linear, false, false); }
+			// Closest-edge queries run directly against the path segments
+			EdgeBVH = MakeShared<PCGExGeo::FSegmentBVH>(
+				this->NumEdges, [&](const int32 Index, FVector& OutStart, FVector& OutEnd)
+				{
+					const FPathEdge& E = this->Edges[Index];
+					OutStart = this->GetPos_Unsafe(E.Start);
+					OutEnd = this->GetPos_Unsafe(E.End);
+				});
 		}
 
 		virtual void EnsureWinding(const EPCGExWinding Winding = EPCGExWinding::CounterClockwise) override
@@ -809,18 +816,38 @@ namespace PCGExPaths
 
 		virtual FTransform GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp) const override
 		{
-			const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
-			OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
-			OutLerp = ClosestKey - OutEdgeIndex;
-			return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, false);
+			OutEdgeIndex = GetClosestEdge(WorldPosition, OutLerp);
+			if (!this->IsValidEdgeIndex(OutEdgeIndex)) { return Positions.IsEmpty() ? FTransform::Identity : FTransform(Positions[0].GetRotation(), Positions[0].GetLocation()); }
+
+			const FPathEdge& E = this->Edges[OutEdgeIndex];
+			const FTransform& A = Positions[E.Start];
+			const FTransform& B = Positions[E.End];
+
+			const FVector Up = FQuat::Slerp(A.GetRotation(), B.GetRotation(), OutLerp).GetUpVector();
+			const FQuat Rotation = E.Dir.IsNearlyZero() ? A.GetRotation() : FRotationMatrix::MakeFromXZ(E.Dir, Up).ToQuat();
+
+			return FTransform(Rotation, FMath::Lerp(A.GetLocation(), B.GetLocation(), static_cast<double>(OutLerp)), FVector::OneVector);
 		}
 
 		virtual int32 GetClosestEdge(const FVector& WorldPosition, float& OutLerp) const override
 		{
-			const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
-			const int32 OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
-			OutLerp = ClosestKey - OutEdgeIndex;
-			return FMath::Min(OutEdgeIndex, this->LastEdge);
+			OutLerp = 0;
+			if (!EdgeBVH || !EdgeBVH->IsValid()) { return 0; }
+
+			double DistSquared = 0;
+			double Alpha = 0;
+			int32 EdgeIndex = EdgeBVH->FindClosest(WorldPosition, DistSquared, Alpha);
+			if (EdgeIndex == -1) { return 0; }
+
+			// Prefer the start of the next edge over the end of this one, matching spline key semantics
+			if (Alpha >= 1 && EdgeIndex < this->LastEdge)
+			{
+				EdgeIndex++;
+				Alpha = 0;
+			}
+
+			OutLerp = static_cast<float>(Alpha);
+			return EdgeIndex;
 		}
 
 		virtual int32 GetClosestEdge(const double InTime, float& OutLerp) const override
@@ -92,12 +92,17 @@ namespace PCGExResamplePath
 	{
 		int32 NumSamples = 0;
 		double SampleLength = 0;
-		TArray<FPointSample> Samples;
 
 		TSharedPtr<PCGExDataBlending::FMetadataBlender> MetadataBlender;
 
 		TSharedPtr<PCGExPaths::FPath> Path;
-		TSharedPtr<PCGExPaths::FPathEdgeLength> PathLength;
+
+		// Arc length at the end of each edge, inclusive
+		TArray<double> CumulativeLength;
+		TArray<double> ScopeLengths;
+		double TotalLength = 0;
+
+		static constexpr int32 ArcLengthChunkSize = 4096;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
@@ -106,8 +111,14 @@ namespace PCGExResamplePath
 		}
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
-		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+
+		void ScanArcLength(const PCGExMT::FScope& Scope);
+		void OffsetArcLength();
 
 		virtual void CompleteWork() override;
+
+		void GetSample(const int32 Index, FPointSample& OutSample) const;
+		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 	};
 }
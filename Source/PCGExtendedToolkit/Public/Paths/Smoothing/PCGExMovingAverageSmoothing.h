@@ -11,8 +11,140 @@
 
 class FPCGExMovingAverageSmoothing : public FPCGExSmoothingOperation
 {
+protected:
+	// Running sums of (Position - Origin, 1); W accumulates the weight.
+	// Index-weighted sums are kept local to fixed-size blocks and rebased on the target index when queried,
+	// so their magnitude depends on the block size and window rather than on the path length.
+	static constexpr int32 BlockSize = 64;
+
+	TArray<FVector4> Local0; // Sum of v_i for i in [block start, j)
+	TArray<FVector4> Local1; // Sum of (i - block start) * v_i for i in [block start, j)
+	TArray<FVector4> Block0; // Per-block totals of the above
+	TArray<FVector4> Block1;
+	FVector4 FirstValue = FVector4(0, 0, 0, 0);
+	FVector4 LastValue = FVector4(0, 0, 0, 0);
+	FVector Origin = FVector::ZeroVector;
+	bool bUsePrefixSums = false;
+
+	// Accumulate sums of v_j and (j - T) * v_j for j in [A, B), with 0 <= A <= B <= NumPoints
+	void AccumulateRange(int32 A, const int32 B, const double T, FVector4& S0, FVector4& S1) const
+	{
+		const int32 NumPoints = Local0.Num();
+
+		while (A < B)
+		{
+			const int32 Block = A / BlockSize;
+			const int32 Start = Block * BlockSize;
+			const int32 End = FMath::Min(Start + BlockSize, NumPoints);
+			const int32 To = FMath::Min(B, End);
+
+			const FVector4 P0 = (To == End ? Block0[Block] : Local0[To]) - Local0[A];
+			const FVector4 P1 = (To == End ? Block1[Block] : Local1[To]) - Local1[A];
+
+			S0 += P0;
+			S1 += P1 + P0 * (Start - T);
+
+			A = To;
+		}
+	}
+
+	// Sums of v_j and (j - T) * v_j for j in [A, B), with out-of-range indices resolved like SanitizeIndex would
+	void RangeSums(const int32 A, const int32 B, const double T, FVector4& OutS0, FVector4& OutS1) const
+	{
+		const int32 NumPoints = Local0.Num();
+
+		OutS0 = FVector4(0, 0, 0, 0);
+		OutS1 = FVector4(0, 0, 0, 0);
+
+		if (B <= A) { return; }
+
+		if (bClosedLoop || IndexSafety == EPCGExIndexSafety::Tile)
+		{
+			// Periodic extension, one period at a time
+			int32 Lo = A;
+			while (Lo < B)
+			{
+				const int32 Offset = FMath::FloorToInt32(static_cast<double>(Lo) / NumPoints) * NumPoints;
+				const int32 Hi = FMath::Min(B, Offset + NumPoints);
+				AccumulateRange(Lo - Offset, Hi - Offset, T - Offset, OutS0, OutS1);
+				Lo = Hi;
+			}
+			return;
+		}
+
+		AccumulateRange(FMath::Clamp(A, 0, NumPoints), FMath::Clamp(B, 0, NumPoints), T, OutS0, OutS1);
+
+		if (IndexSafety != EPCGExIndexSafety::Clamp) { return; }
+
+		// Clamped indices repeat the first & last points
+		auto AddRepeated = [&](const int32 From, const int32 To, const FVector4& V)
+		{
+			if (To <= From) { return; }
+			const double Count = To - From;
+			const double OffsetSum = (static_cast<double>(From) + static_cast<double>(To - 1)) * Count * 0.5 - Count * T;
+			OutS0 += V * Count;
+			OutS1 += V * OffsetSum;
+		};
+
+		AddRepeated(A, FMath::Min(B, 0), FirstValue);
+		AddRepeated(FMath::Max(A, NumPoints), B, LastValue);
+	}
+
 public:
 	EPCGExIndexSafety IndexSafety = EPCGExIndexSafety::Ignore;
+	bool bPrefixSumPositions = false;
+
+	virtual void PrepareForData(const double InConstantSmoothing) override
+	{
+		// Yoyo indices aren't expressible as contiguous ranges; keep the blended path
+		bUsePrefixSums = bPrefixSumPositions && (bClosedLoop || IndexSafety != EPCGExIndexSafety::Yoyo);
+		if (!bUsePrefixSums) { return; }
+
+		TConstPCGValueRange<FTransform> InTransforms = Path->GetIn()->GetConstTransformValueRange();
+		const int32 NumPoints = InTransforms.Num();
+
+		if (!NumPoints)
+		{
+			bUsePrefixSums = false;
+			return;
+		}
+
+		Origin = FVector::ZeroVector;
+		for (const FTransform& Transform : InTransforms) { Origin += Transform.GetLocation(); }
+		Origin /= NumPoints;
+
+		const int32 NumBlocks = (NumPoints + BlockSize - 1) / BlockSize;
+
+		Local0.SetNumUninitialized(NumPoints);
+		Local1.SetNumUninitialized(NumPoints);
+		Block0.SetNumUninitialized(NumBlocks);
+		Block1.SetNumUninitialized(NumBlocks);
+
+		for (int b = 0; b < NumBlocks; b++)
+		{
+			const int32 Start = b * BlockSize;
+			const int32 End = FMath::Min(Start + BlockSize, NumPoints);
+
+			FVector4 S0 = FVector4(0, 0, 0, 0);
+			FVector4 S1 = FVector4(0, 0, 0, 0);
+
+			for (int i = Start; i < End; i++)
+			{
+				Local0[i] = S0;
+				Local1[i] = S1;
+
+				const FVector4 V = FVector4(InTransforms[i].GetLocation() - Origin, 1);
+				S0 += V;
+				S1 += V * static_cast<double>(i - Start);
+			}
+
+			Block0[b] = S0;
+			Block1[b] = S1;
+		}
+
+		FirstValue = FVector4(InTransforms[0].GetLocation() - Origin, 1);
+		LastValue = FVector4(InTransforms[NumPoints - 1].GetLocation() - Origin, 1);
+	}
 
 	virtual void SmoothSingle(const int32 TargetIndex, const double Smoothing, const double Influence, TArray<PCGEx::FOpStats>& Trackers) override
 	{
@@ -24,6 +156,25 @@ public:
 
 		const double SafeWindowSize = FMath::Max(1, SmoothingInt);
 
+		if (bUsePrefixSums)
+		{
+			// Triangular window from running sums : weight of j is (W - |j - T|) / W
+			const int32 W = SafeWindowSize;
+			const double T = TargetIndex;
+
+			FVector4 L0, L1, R0, R1;
+			RangeSums(TargetIndex - W, TargetIndex + 1, T, L0, L1);
+			RangeSums(TargetIndex + 1, TargetIndex + W + 1, T, R0, R1);
+
+			const FVector4 Sum = (L0 * W + L1 + R0 * W - R1) / SafeWindowSize;
+			if (Sum.W <= 0) { return; }
+
+			TPCGValueRange<FTransform> OutTransforms = Path->GetOut()->GetTransformValueRange(false);
+			const FVector Average = Origin + FVector(Sum.X, Sum.Y, Sum.Z) / Sum.W;
+			OutTransforms[TargetIndex].SetLocation(FMath::Lerp(OutTransforms[TargetIndex].GetLocation(), Average, Influence));
+			return;
+		}
+
 		Blender->BeginMultiBlend(TargetIndex, Trackers);
 
 		if (bClosedLoop)
@@ -65,9 +216,14 @@ public:
 	{
 		PCGEX_FACTORY_NEW_OPERATION(MovingAverageSmoothing)
 		NewOperation->IndexSafety = IndexSafety;
+		NewOperation->bPrefixSumPositions = bPrefixSumPositions;
 		return NewOperation;
 	}
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	EPCGExIndexSafety IndexSafety = EPCGExIndexSafety::Ignore;
+
+	/** Smooth positions only, using blocked running sums so the cost barely depends on the smoothing amount. Attributes are left untouched. Not available with Yoyo index safety. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	bool bPrefixSumPositions = false;
 };
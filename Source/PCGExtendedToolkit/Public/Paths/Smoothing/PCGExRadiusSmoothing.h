@@ -11,7 +11,64 @@
 
 class FPCGExRadiusSmoothing : public FPCGExSmoothingOperation
 {
+protected:
+	// Uniform grid sized to the smoothing radius, so a gather touches at most 3x3x3 cells.
+	// Cells are stored CSR-style; indices within a cell are ascending.
+	double CellSize = 0;
+	TMap<FIntVector, int32> CellMap;
+	TArray<int32> CellStarts;
+	TArray<int32> CellIndices;
+
+	FORCEINLINE FIntVector GetCell(const FVector& Position) const
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Position.X / CellSize),
+			FMath::FloorToInt32(Position.Y / CellSize),
+			FMath::FloorToInt32(Position.Z / CellSize));
+	}
+
 public:
+	virtual void PrepareForData(const double InConstantSmoothing) override
+	{
+		if (InConstantSmoothing <= 0) { return; } // Per-point radius, use the point octree
+
+		CellSize = InConstantSmoothing;
+
+		TConstPCGValueRange<FTransform> InTransforms = Path->GetIn()->GetConstTransformValueRange();
+		const int32 NumPoints = InTransforms.Num();
+
+		TArray<int32> PointCells;
+		PointCells.SetNumUninitialized(NumPoints);
+		CellMap.Reserve(NumPoints / 4);
+
+		for (int i = 0; i < NumPoints; i++)
+		{
+			const FIntVector Cell = GetCell(InTransforms[i].GetLocation());
+			int32& CellIndex = CellMap.FindOrAdd(Cell, -1);
+			if (CellIndex == -1)
+			{
+				CellIndex = CellStarts.Num();
+				CellStarts.Add(0);
+			}
+			CellStarts[CellIndex]++;
+			PointCells[i] = CellIndex;
+		}
+
+		// Counts to offsets
+		int32 Offset = 0;
+		for (int32& Start : CellStarts)
+		{
+			const int32 Count = Start;
+			Start = Offset;
+			Offset += Count;
+		}
+		CellStarts.Add(Offset);
+
+		TArray<int32> Cursor = CellStarts;
+		CellIndices.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++) { CellIndices[Cursor[PointCells[i]]++] = i; }
+	}
+
 	virtual void SmoothSingle(
 		const int32 TargetIndex,
 		const double Smoothing, const double Influence, TArray<PCGEx::FOpStats>& Trackers) override
@@ -26,14 +83,43 @@ public:
 
 		Blender->BeginMultiBlend(TargetIndex, Trackers);
 
-		Path->GetIn()->GetPointOctree().FindElementsWithBoundsTest(
-			FBoxCenterAndExtent(Origin, FVector(Smoothing)), [&](const PCGPointOctree::FPointRef& PointRef)
+		if (CellSize > 0 && Smoothing <= CellSize)
+		{
+			const FIntVector Min = GetCell(Origin - FVector(Smoothing));
+			const FIntVector Max = GetCell(Origin + FVector(Smoothing));
+
+			for (int32 X = Min.X; X <= Max.X; X++)
 			{
-				const double Dist = FVector::DistSquared(Origin, InTransforms[PointRef.Index].GetLocation());
-				if (Dist >= RadiusSquared || PointRef.Index == TargetIndex) { return; }
+				for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+				{
+					for (int32 Z = Min.Z; Z <= Max.Z; Z++)
+					{
+						const int32* CellIndex = CellMap.Find(FIntVector(X, Y, Z));
+						if (!CellIndex) { continue; }
+
+						for (int32 c = CellStarts[*CellIndex]; c < CellStarts[*CellIndex + 1]; c++)
+						{
+							const int32 Index = CellIndices[c];
+							const double Dist = FVector::DistSquared(Origin, InTransforms[Index].GetLocation());
+							if (Dist >= RadiusSquared || Index == TargetIndex) { continue; }
+
+							Blender->MultiBlend(Index, TargetIndex, (1 - (Dist / RadiusSquared)) * Influence, Trackers);
+						}
+					}
+				}
+			}
+		}
+		else
+		{
+			Path->GetIn()->GetPointOctree().FindElementsWithBoundsTest(
+				FBoxCenterAndExtent(Origin, FVector(Smoothing)), [&](const PCGPointOctree::FPointRef& PointRef)
+				{
+					const double Dist = FVector::DistSquared(Origin, InTransforms[PointRef.Index].GetLocation());
+					if (Dist >= RadiusSquared || PointRef.Index == TargetIndex) { return; }
 
-				Blender->MultiBlend(PointRef.Index, TargetIndex, (1 - (Dist / RadiusSquared)) * Influence, Trackers);
-			});
+					Blender->MultiBlend(PointRef.Index, TargetIndex, (1 - (Dist / RadiusSquared)) * Influence, Trackers);
+				});
+		}
 
 		Blender->EndMultiBlend(TargetIndex, Trackers);
 	}
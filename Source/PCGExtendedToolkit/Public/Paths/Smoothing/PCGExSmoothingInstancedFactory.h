@@ -21,6 +21,11 @@ class FPCGExSmoothingOperation : public FPCGExOperation
 	friend class PCGExSmooth::FProcessor;
 
 public:
+	// Called once before parallel smoothing. InConstantSmoothing is the smoothing amount if it is the same for every point, -1 otherwise.
+	virtual void PrepareForData(const double InConstantSmoothing)
+	{
+	}
+
 	virtual void SmoothSingle(const int32 TargetIndex, const double Smoothing, const double Influence, TArray<PCGEx::FOpStats>& Trackers)
 	{
 	}
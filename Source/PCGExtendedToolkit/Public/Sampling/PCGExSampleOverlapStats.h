@@ -126,14 +126,9 @@ struct FPCGExSampleOverlapStatsContext final : FPCGExPointsProcessorContext
 {
 	friend class FPCGExSampleOverlapStatsElement;
 
-	mutable FRWLock OverlapLock;
 	TMap<uint64, TSharedPtr<PCGExSampleOverlapStats::FOverlap>> OverlapMap;
 
-	TSharedPtr<PCGExSampleOverlapStats::FOverlap> RegisterOverlap(
-		PCGExSampleOverlapStats::FProcessor* InA,
-		PCGExSampleOverlapStats::FProcessor* InB,
-		const FBox& InIntersection);
-
+	virtual void BatchProcessing_InitialProcessingDone() override;
 	virtual void BatchProcessing_WorkComplete() override;
 
 	PCGEX_FOREACH_FIELD_SAMPLEOVERLAPSTATS(PCGEX_OUTPUT_DECL_TOGGLE)
@@ -221,7 +216,8 @@ namespace PCGExSampleOverlapStats
 
 		TArray<TSharedPtr<PCGExDiscardByOverlap::FPointBounds>> LocalPointBounds;
 
-		mutable FRWLock RegistrationLock;
+		TSharedPtr<PCGExMT::TScopedValue<FBox>> ScopedBounds;
+
 		TArray<TSharedRef<FOverlap>> Overlaps;
 		TArray<TSharedRef<FOverlap>> ManagedOverlaps;
 
@@ -253,14 +249,12 @@ namespace PCGExSampleOverlapStats
 
 		virtual ~FProcessor() override;
 
-		FORCEINLINE void RegisterPointBounds(const int32 Index, const TSharedPtr<PCGExDiscardByOverlap::FPointBounds>& InPointBounds)
+		FORCEINLINE void RegisterPointBounds(const PCGExMT::FScope& Scope, const int32 Index, const TSharedPtr<PCGExDiscardByOverlap::FPointBounds>& InPointBounds)
 		{
-			Bounds += InPointBounds->Bounds.GetBox();
+			ScopedBounds->GetMutable(Scope) += InPointBounds->Bounds.GetBox();
 			LocalPointBounds[Index] = InPointBounds;
 		}
 
-		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
-
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InAsyncManager) override;
 		void ResolveOverlap(const int32 Index);
 		void WriteSingleData(const int32 Index);
@@ -54,6 +54,7 @@ class FPCGExTensorPathFlow : public PCGExTensorOperation
 public:
 	FPCGExTensorPathFlowConfig Config;
 	const TArray<TSharedPtr<const FPCGSplineStruct>>* Splines = nullptr;
+	const PCGEx::FIndexedItemOctree* SplineOctree = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
@@ -48,6 +48,7 @@ class FPCGExTensorPathPole : public PCGExTensorOperation
 public:
 	FPCGExTensorPathPoleConfig Config;
 	const TArray<TSharedPtr<const FPCGSplineStruct>>* Splines = nullptr;
+	const PCGEx::FIndexedItemOctree* SplineOctree = nullptr;
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
 };
@@ -15,6 +15,31 @@
 
 class PCGExTensorOperation;
 
+namespace PCGExTensor
+{
+	/**
+	 * Invoke Func for each spline whose influence bounds contain the position, in ascending order.
+	 * Without an octree every spline is a candidate.
+	 */
+	template <typename FFunc>
+	void ForEachSplineCandidate(const PCGEx::FIndexedItemOctree* InOctree, const int32 NumSplines, const FVector& InPosition, FFunc&& Func)
+	{
+		if (!InOctree)
+		{
+			for (int i = 0; i < NumSplines; i++) { Func(i); }
+			return;
+		}
+
+		TArray<int32, TInlineAllocator<16>> Candidates;
+		InOctree->FindElementsWithBoundsTest(
+			FBoxCenterAndExtent(InPosition, FVector::ZeroVector),
+			[&](const PCGEx::FIndexedItem& Item) { Candidates.AddUnique(Item.Index); });
+
+		if (Candidates.Num() > 1) { Candidates.Sort(); }
+		for (const int32 i : Candidates) { Func(i); }
+	}
+}
+
 UCLASS(Abstract, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
 class PCGEXTENDEDTOOLKIT_API UPCGExTensorSplineFactoryData : public UPCGExTensorFactoryData
 {
@@ -25,16 +50,25 @@ public:
 	bool bSmoothLinear = true;
 	bool bBuildFromPaths = false;
 
+	/** Base influence radius, used to expand the per-segment bounds of the spline octree */
+	double InfluenceRadius = 0;
+
+	FORCEINLINE const PCGEx::FIndexedItemOctree* GetSplineOctree() const { return SplineOctree.Get(); }
+
 protected:
 	TArray<TSharedPtr<const FPCGSplineStruct>> ManagedSplines;
 	TArray<FPCGSplineStruct> Splines;
 
+	TSharedPtr<PCGEx::FIndexedItemOctree> SplineOctree;
+
 	EPCGExSplineSamplingIncludeMode SampleInputs = EPCGExSplineSamplingIncludeMode::All;
 
 	virtual bool WantsPreparation(FPCGExContext* InContext) override { return true; }
 	virtual bool InitInternalData(FPCGExContext* InContext) override;
 	virtual bool InitInternalFacade(FPCGExContext* InContext);
 
+	void BuildSplineOctree(const int32 NumSplines, const TFunctionRef<const FPCGSplineStruct&(int32)>& GetSpline);
+
 	virtual void BeginDestroy() override;
 };
 
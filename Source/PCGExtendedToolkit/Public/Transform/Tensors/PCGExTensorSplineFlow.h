@@ -44,6 +44,7 @@ class FPCGExTensorSplineFlow : public PCGExTensorOperation
 public:
 	FPCGExTensorSplineFlowConfig Config;
 	const TArray<FPCGSplineStruct>* Splines = nullptr;
+	const PCGEx::FIndexedItemOctree* SplineOctree = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 
@@ -40,6 +40,7 @@ class FPCGExTensorSplinePole : public PCGExTensorOperation
 public:
 	FPCGExTensorSplinePoleConfig Config;
 	const TArray<FPCGSplineStruct>* Splines = nullptr;
+	const PCGEx::FIndexedItemOctree* SplineOctree = nullptr;
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 